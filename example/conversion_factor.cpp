@@ -20,24 +20,12 @@
 #include <mp-units/systems/si/unit_symbols.h>
 #include <mp-units/systems/si/units.h>
 #include <iostream>
-#include <type_traits>
 
 /*
   get conversion factor from one dimensionally equivalent
   quantity type to another
 */
 
-namespace {
-
-template<mp_units::Quantity Target, mp_units::Quantity Source>
-  requires std::constructible_from<Target, Source>
-inline constexpr double conversion_factor(Target, Source)
-{
-  return (1. * Source::reference).force_numerical_value_in(Target::unit);
-}
-
-}  // namespace
-
 int main()
 {
   using namespace mp_units;
@@ -58,5 +46,5 @@ int main()
             << MP_UNITS_STD_FMT::format("lengthB.value( {} ) == lengthA.value( {} ) * conversion_factor( {} )\n",
                                         lengthB.numerical_value_ref_in(lengthB.unit),
                                         lengthA.numerical_value_ref_in(lengthA.unit),
-                                        conversion_factor(lengthB, lengthA));
+                                        conversion_factor_v<lengthA.unit, lengthB.unit>);
 }
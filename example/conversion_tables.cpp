@@ -0,0 +1,135 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mp-units/conversion_table.h>
+#include <mp-units/systems/cgs/cgs.h>
+#include <mp-units/systems/imperial/imperial.h>
+#include <mp-units/systems/international/international.h>
+#include <mp-units/systems/si/si.h>
+#include <mp-units/systems/usc/usc.h>
+#include <array>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string_view>
+
+/*
+  exports the tables of the conversion factors between the units of the systems
+  as CSV to be loaded into environments doing the conversions as plain multiplications
+
+  every table lists all the named units of its system together with a few SI units
+  anchoring it to the metric ones; the prefixed units are left out as they are
+  unbounded and their factors follow directly from the prefixes
+*/
+
+namespace {
+
+using namespace mp_units;
+
+// units are identified by their names rather than symbols as the latter are not unique within a system
+// (e.g. `usc::barrel`, `usc::oil_barrel`, and `usc::dry_barrel` are all "bbl")
+template<typename Table>
+void print(std::string_view system, const std::array<std::string_view, Table::size>& names, Table)
+{
+  const auto symbols = Table::symbols(unit_symbol_formatting{.encoding = text_encoding::ascii});
+  for (std::size_t i = 0; i < Table::size; ++i)
+    for (std::size_t j = 0; j < Table::size; ++j)
+      if (i != j && Table::factors[i][j] != 0)
+        std::cout << system << ',' << names[i] << ',' << symbols[i] << ',' << names[j] << ',' << symbols[j] << ','
+                  << Table::factors[i][j] << '\n';
+}
+
+}  // namespace
+
+int main()
+{
+  std::cout << std::setprecision(std::numeric_limits<double>::max_digits10);
+  std::cout << "system,from,from_symbol,to,to_symbol,factor\n";
+
+  print("si",
+        {"si::second", "si::metre", "si::gram", "si::kilogram", "si::ampere", "si::kelvin", "si::mole", "si::candela",
+         "si::radian", "si::steradian", "si::hertz", "si::newton", "si::pascal", "si::joule", "si::watt",
+         "si::coulomb", "si::volt", "si::farad", "si::ohm", "si::siemens", "si::weber", "si::tesla", "si::henry",
+         "si::degree_Celsius", "si::lumen", "si::lux", "si::becquerel", "si::gray", "si::sievert", "si::katal",
+         "si::minute", "si::hour", "si::day", "si::astronomical_unit", "si::degree", "si::arcminute", "si::arcsecond",
+         "si::are", "si::hectare", "si::litre", "si::tonne", "si::dalton", "si::electronvolt"},
+        conversion_table<double, si::second, si::metre, si::gram, si::kilogram, si::ampere, si::kelvin, si::mole,
+                         si::candela, si::radian, si::steradian, si::hertz, si::newton, si::pascal, si::joule,
+                         si::watt, si::coulomb, si::volt, si::farad, si::ohm, si::siemens, si::weber, si::tesla,
+                         si::henry, si::degree_Celsius, si::lumen, si::lux, si::becquerel, si::gray, si::sievert,
+                         si::katal, si::minute, si::hour, si::day, si::astronomical_unit, si::degree, si::arcminute,
+                         si::arcsecond, si::are, si::hectare, si::litre, si::tonne, si::dalton, si::electronvolt>{});
+  print("international",
+        {"international::pound", "international::ounce", "international::dram", "international::grain",
+         "international::yard", "international::foot", "international::inch", "international::pica",
+         "international::point", "international::mil", "international::twip", "international::mile",
+         "international::league", "international::nautical_mile", "international::knot", "international::poundal",
+         "international::pound_force", "international::kip", "international::psi",
+         "international::mechanical_horsepower", "si::metre", "si::kilogram", "si::newton", "si::pascal", "si::watt"},
+        conversion_table<double, international::pound, international::ounce, international::dram,
+                         international::grain, international::yard, international::foot, international::inch,
+                         international::pica, international::point, international::mil, international::twip,
+                         international::mile, international::league, international::nautical_mile,
+                         international::knot, international::poundal, international::pound_force, international::kip,
+                         international::psi, international::mechanical_horsepower, si::metre, si::kilogram,
+                         si::newton, si::pascal, si::watt>{});
+  print("usc",
+        {"usc::fathom", "usc::cable", "usc::link", "usc::rod", "usc::chain", "usc::furlong",
+         "usc::survey1893::us_survey_foot", "usc::survey1893::link", "usc::survey1893::rod", "usc::survey1893::chain",
+         "usc::survey1893::furlong", "usc::survey1893::us_survey_mile", "usc::survey1893::league", "usc::acre",
+         "usc::section", "usc::gallon", "usc::pottle", "usc::quart", "usc::pint", "usc::cup", "usc::gill",
+         "usc::fluid_ounce", "usc::tablespoon", "usc::shot", "usc::teaspoon", "usc::minim", "usc::fluid_dram",
+         "usc::barrel", "usc::oil_barrel", "usc::hogshead", "usc::dry_barrel", "usc::bushel", "usc::peck",
+         "usc::dry_gallon", "usc::dry_quart", "usc::dry_pint", "usc::quarter", "usc::short_hundredweight", "usc::ton",
+         "usc::pennyweight", "usc::troy_once", "usc::troy_pound", "usc::inch_of_mercury", "usc::degree_Fahrenheit",
+         "si::metre", "si::hectare", "si::litre", "si::kilogram", "si::pascal", "si::degree_Celsius"},
+        conversion_table<double, usc::fathom, usc::cable, usc::link, usc::rod, usc::chain, usc::furlong,
+                         usc::survey1893::us_survey_foot, usc::survey1893::link, usc::survey1893::rod,
+                         usc::survey1893::chain, usc::survey1893::furlong, usc::survey1893::us_survey_mile,
+                         usc::survey1893::league, usc::acre, usc::section, usc::gallon, usc::pottle, usc::quart,
+                         usc::pint, usc::cup, usc::gill, usc::fluid_ounce, usc::tablespoon, usc::shot, usc::teaspoon,
+                         usc::minim, usc::fluid_dram, usc::barrel, usc::oil_barrel, usc::hogshead, usc::dry_barrel,
+                         usc::bushel, usc::peck, usc::dry_gallon, usc::dry_quart, usc::dry_pint, usc::quarter,
+                         usc::short_hundredweight, usc::ton, usc::pennyweight, usc::troy_once, usc::troy_pound,
+                         usc::inch_of_mercury, usc::degree_Fahrenheit, si::metre, si::hectare, si::litre,
+                         si::kilogram, si::pascal, si::degree_Celsius>{});
+  print("imperial",
+        {"imperial::hand", "imperial::barleycorn", "imperial::thou", "imperial::chain", "imperial::furlong",
+         "imperial::cable", "imperial::fathom", "imperial::link", "imperial::rod", "imperial::perch",
+         "imperial::rood", "imperial::acre", "imperial::gallon", "imperial::quart", "imperial::pint",
+         "imperial::gill", "imperial::fluid_ounce", "imperial::stone", "imperial::quarter",
+         "imperial::long_hundredweight", "imperial::ton", "si::metre", "si::hectare", "si::litre", "si::kilogram"},
+        conversion_table<double, imperial::hand, imperial::barleycorn, imperial::thou, imperial::chain,
+                         imperial::furlong, imperial::cable, imperial::fathom, imperial::link, imperial::rod,
+                         imperial::perch, imperial::rood, imperial::acre, imperial::gallon, imperial::quart,
+                         imperial::pint, imperial::gill, imperial::fluid_ounce, imperial::stone, imperial::quarter,
+                         imperial::long_hundredweight, imperial::ton, si::metre, si::hectare, si::litre,
+                         si::kilogram>{});
+  print("cgs",
+        {"cgs::centimetre", "cgs::gram", "cgs::second", "cgs::gal", "cgs::dyne", "cgs::erg", "cgs::barye",
+         "cgs::poise", "cgs::stokes", "cgs::kayser", "si::metre", "si::kilogram", "si::newton", "si::joule",
+         "si::pascal"},
+        conversion_table<double, cgs::centimetre, cgs::gram, cgs::second, cgs::gal, cgs::dyne, cgs::erg, cgs::barye,
+                         cgs::poise, cgs::stokes, cgs::kayser, si::metre, si::kilogram, si::newton, si::joule,
+                         si::pascal>{});
+}
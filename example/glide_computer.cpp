@@ -26,10 +26,12 @@
 #include <mp-units/math.h>
 #include <mp-units/systems/international/international.h>
 #include <mp-units/systems/si/unit_symbols.h>
+#include <algorithm>
 #include <array>
 #include <exception>
 #include <iostream>
 #include <iterator>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -120,6 +122,16 @@ void print(const R& waypoints)
   std::cout << "\n";
 }
 
+void print(const waypoint_database& db, const waypoint& center, distance radius)
+{
+  std::cout << "Nearby waypoints:\n";
+  std::cout << "=================\n";
+  std::cout << MP_UNITS_STD_FMT::format("- Within {:%.0Q %q} from {}:\n", radius, center.name);
+  for (const auto& n : db.within(center.pos, radius))
+    std::cout << MP_UNITS_STD_FMT::format("  * {} ({:%.1Q %q})\n", n.wpt->name, n.dist);
+  std::cout << "\n";
+}
+
 void print(const task& t)
 {
   std::cout << "Task:\n";
@@ -132,8 +144,8 @@ void print(const task& t)
   std::cout << "- Legs: "
             << "\n";
   for (const auto& l : t.get_legs())
-    std::cout << MP_UNITS_STD_FMT::format("  * {} -> {} ({:%.1Q %q})\n", l.begin().name, l.end().name,
-                                          l.get_distance());
+    std::cout << MP_UNITS_STD_FMT::format("  * {} -> {} ({:%.1Q %q})\n", t.get_waypoints()[l.begin_index()].name,
+                                          t.get_waypoints()[l.end_index()].name, l.get_distance());
   std::cout << "\n";
 }
 
@@ -163,6 +175,7 @@ void example()
   const auto gliders = get_gliders();
   const auto waypoints = get_waypoints();
   const auto weather_conditions = get_weather_conditions();
+  const waypoint_database db(std::vector<waypoint>(waypoints.begin(), waypoints.end()));
   const task t = {waypoints[0], waypoints[1], waypoints[0]};
   const aircraft_tow tow = {400 * m, 1.6 * m / s};
   // TODO use C++20 date library when available
@@ -172,17 +185,25 @@ void example()
   print(sfty);
   print(gliders);
   print(waypoints);
+  print(db, waypoints[0], 100. * km);
   print(weather_conditions);
   print(t);
   print(tow);
 
-  for (const auto& g : gliders) {
+  std::vector<weather> conditions;
+  std::ranges::transform(weather_conditions, std::back_inserter(conditions), [](const auto& c) { return c.second; });
+
+  thread_pool pool;
+  const std::vector<flight_estimate> estimates =
+    simulate(start_time, gliders, conditions, std::span(&t, 1), sfty, tow, pool);
+
+  for (auto it = estimates.cbegin(); const auto& g : gliders) {
     for (const auto& c : weather_conditions) {
       std::string txt = "Scenario: Glider = " + g.name + ", Weather = " + c.first;
       std::cout << txt << "\n";
       std::cout << MP_UNITS_STD_FMT::format("{0:=^{1}}\n\n", "", txt.size());
 
-      estimate(start_time, g, c.second, t, sfty, tow);
+      print(*it++);
 
       std::cout << "\n\n";
     }
@@ -23,38 +23,68 @@
 #include "glide_computer_lib.h"
 #include <mp-units/format.h>
 #include <iostream>
-#include <numeric>
+#include <ranges>
 #include <string_view>
+#include <utility>
 
 namespace glide_computer {
 
 using namespace mp_units;
 
+waypoint_database::waypoint_database(std::vector<waypoint> wpts) :
+    waypoints_(std::move(wpts)), index_(waypoints_ | std::views::transform(&waypoint::pos))
+{
+}
+
+waypoint_database::waypoint_database(std::vector<waypoint> wpts, thread_pool& pool) :
+    waypoints_(std::move(wpts)), index_(waypoints_ | std::views::transform(&waypoint::pos), pool)
+{
+}
+
+std::vector<waypoint_database::neighbour> waypoint_database::within(const geographic::position<long double>& pos,
+                                                                    distance radius) const
+{
+  return to_neighbours(index_.within(pos, radius));
+}
+
+std::vector<waypoint_database::neighbour> waypoint_database::nearest(const geographic::position<long double>& pos,
+                                                                     std::size_t count) const
+{
+  return to_neighbours(index_.nearest(pos, count));
+}
+
+std::vector<waypoint_database::neighbour> waypoint_database::to_neighbours(
+  const std::vector<geographic::spatial_index::neighbour>& found) const
+{
+  std::vector<neighbour> res;
+  res.reserve(found.size());
+  for (const auto& n : found) res.push_back({&waypoints_[n.index], n.dist});
+  return res;
+}
+
 task::legs task::make_legs(const waypoints& wpts)
 {
   task::legs res;
   res.reserve(wpts.size() - 1);
-  auto to_leg = [](const waypoint& w1, const waypoint& w2) { return task::leg(w1, w2); };
-  std::ranges::transform(wpts.cbegin(), prev(wpts.cend()), next(wpts.cbegin()), wpts.cend(), std::back_inserter(res),
-                         to_leg);
+  distance offset = distance::zero();
+  for (std::size_t i = 0; i + 1 < wpts.size(); ++i) {
+    res.emplace_back(i, wpts[i], wpts[i + 1], offset);
+    offset += res.back().get_distance();
+  }
   return res;
 }
 
-std::vector<distance> task::make_leg_total_distances(const legs& legs)
+geographic::msl_altitude terrain_level_alt(const task& t, const flight_point& pos)
 {
-  std::vector<distance> res;
-  res.reserve(legs.size());
-  auto to_length = [](const leg& l) { return l.get_distance(); };
-  std::transform_inclusive_scan(legs.cbegin(), legs.cend(), std::back_inserter(res), std::plus(), to_length,
-                                distance::zero());
-  return res;
+  return t.get_legs()[pos.leg_idx].terrain_level_alt(pos.dist);
 }
 
-geographic::msl_altitude terrain_level_alt(const task& t, const flight_point& pos)
+geographic::msl_altitude terrain_level_alt(const task& t, const flight_point& pos,
+                                           const geographic::terrain_grid& terrain)
 {
   const task::leg& l = t.get_legs()[pos.leg_idx];
-  const height alt_diff = l.end().alt - l.begin().alt;
-  return l.begin().alt + alt_diff * ((pos.dist - t.get_leg_dist_offset(pos.leg_idx)) / l.get_distance());
+  const waypoint& begin = t.get_waypoints()[l.begin_index()];
+  return terrain.elevation(geographic::destination(begin.pos, l.get_bearing(), pos.dist - l.get_offset()));
 }
 
 // Returns `x` of the intersection of a glide line and a terrain line.
@@ -74,43 +104,27 @@ namespace {
 
 using namespace glide_computer;
 
-void print(std::string_view phase_name, timestamp start_ts, const glide_computer::flight_point& point,
-           const glide_computer::flight_point& new_point)
-{
-  std::cout << MP_UNITS_STD_FMT::format(
-    "| {:<12} | {:>9%.1Q %q} (Total: {:>9%.1Q %q}) | {:>8%.1Q %q} (Total: {:>8%.1Q %q}) | {:>7%.0Q %q} ({:>6%.0Q %q}) "
-    "|\n",
-    phase_name, value_cast<si::minute>(new_point.ts - point.ts), value_cast<si::minute>(new_point.ts - start_ts),
-    new_point.dist - point.dist, new_point.dist, new_point.alt - point.alt, new_point.alt);
-}
-
 flight_point takeoff(timestamp start_ts, const task& t) { return {start_ts, t.get_start().alt}; }
 
-flight_point tow(timestamp start_ts, const flight_point& pos, const aircraft_tow& at)
+flight_point tow(const flight_point& pos, const aircraft_tow& at)
 {
   const duration d = (at.height_agl / at.performance);
-  const flight_point new_pos{pos.ts + d, pos.alt + at.height_agl, pos.leg_idx, pos.dist};
-
-  print("Tow", start_ts, pos, new_pos);
-  return new_pos;
+  return {pos.ts + d, pos.alt + at.height_agl, pos.leg_idx, pos.dist};
 }
 
-flight_point circle(timestamp start_ts, const flight_point& pos, const glider& g, const weather& w, const task& t,
-                    height& height_to_gain)
+flight_point circle(const flight_point& pos, const glider& g, const weather& w, const task& t, height& height_to_gain)
 {
   const height h_agl = agl(pos.alt, terrain_level_alt(t, pos));
   const height circling_height = std::min(w.cloud_base - h_agl, height_to_gain);
   const rate_of_climb circling_rate = w.thermal_strength + g.polar[0].climb;
   const duration d = (circling_height / circling_rate);
-  const flight_point new_pos{pos.ts + d, pos.alt + circling_height, pos.leg_idx, pos.dist};
 
   height_to_gain -= circling_height;
 
-  print("Circle", start_ts, pos, new_pos);
-  return new_pos;
+  return {pos.ts + d, pos.alt + circling_height, pos.leg_idx, pos.dist};
 }
 
-flight_point glide(timestamp start_ts, const flight_point& pos, const glider& g, const task& t, const safety& s)
+flight_point glide(const flight_point& pos, const glider& g, const task& t, const safety& s)
 {
   const auto ground_alt = terrain_level_alt(t, pos);
   const auto dist = glide_distance(pos, g, t, s, ground_alt);
@@ -118,40 +132,51 @@ flight_point glide(timestamp start_ts, const flight_point& pos, const glider& g,
   const auto alt = ground_alt + s.min_agl_height;
   const auto l3d = length_3d(dist, pos.alt - alt);
   const duration d = l3d / g.polar[0].v;
-  const flight_point new_pos{pos.ts + d, terrain_level_alt(t, pos) + s.min_agl_height, t.get_leg_index(new_distance),
-                             new_distance};
-
-  print("Glide", start_ts, pos, new_pos);
-  return new_pos;
+  return {pos.ts + d, terrain_level_alt(t, pos) + s.min_agl_height, t.get_leg_index(new_distance, pos.leg_idx),
+          new_distance};
 }
 
-flight_point final_glide(timestamp start_ts, const flight_point& pos, const glider& g, const task& t)
+flight_point final_glide(const flight_point& pos, const glider& g, const task& t)
 {
   const auto dist = t.get_distance() - pos.dist;
   const auto l3d = length_3d(dist, pos.alt - t.get_finish().alt);
   const duration d = l3d / g.polar[0].v;
-  const flight_point new_pos{pos.ts + d, t.get_finish().alt, t.get_legs().size() - 1, pos.dist + dist};
-
-  print("Final Glide", start_ts, pos, new_pos);
-  return new_pos;
+  return {pos.ts + d, t.get_finish().alt, t.get_legs().size() - 1, pos.dist + dist};
 }
 
 }  // namespace
 
 namespace glide_computer {
 
-void estimate(timestamp start_ts, const glider& g, const weather& w, const task& t, const safety& s,
-              const aircraft_tow& at)
+std::string_view to_string_view(flight_phase::type t)
 {
-  std::cout << MP_UNITS_STD_FMT::format("| {:<12} | {:^28} | {:^26} | {:^21} |\n", "Flight phase", "Duration",
-                                        "Distance", "Height");
-  std::cout << MP_UNITS_STD_FMT::format("|{0:-^14}|{0:-^30}|{0:-^28}|{0:-^23}|\n", "");
+  switch (t) {
+    case flight_phase::type::tow:
+      return "Tow";
+    case flight_phase::type::glide:
+      return "Glide";
+    case flight_phase::type::circle:
+      return "Circle";
+    case flight_phase::type::final_glide:
+      return "Final Glide";
+  }
+  return "Unknown";
+}
+
+flight_estimate simulate(timestamp start_ts, const glider& g, const weather& w, const task& t, const safety& s,
+                         const aircraft_tow& at)
+{
+  flight_estimate res{start_ts, {}};
+  auto add_phase = [&](flight_phase::type kind, const flight_point& pos, const flight_point& new_pos) {
+    res.phases.push_back({kind, pos, new_pos});
+    return new_pos;
+  };
 
   // ready to takeoff
   flight_point pos = takeoff(start_ts, t);
 
   // estimate aircraft towing
-  pos = tow(start_ts, pos, at);
+  pos = add_phase(flight_phase::type::tow, pos, tow(pos, at));
 
   // estimate the msl_altitude needed to reach the finish line from this place
   const geographic::msl_altitude final_glide_alt =
@@ -162,14 +187,50 @@ void estimate(timestamp start_ts, const glider& g, const weather& w, const task&
 
   do {
     // glide to the next thermall
-    pos = glide(start_ts, pos, g, t, s);
+    pos = add_phase(flight_phase::type::glide, pos, glide(pos, g, t, s));
 
     // circle in a thermall to gain height
-    pos = circle(start_ts, pos, g, w, t, height_to_gain);
+    pos = add_phase(flight_phase::type::circle, pos, circle(pos, g, w, t, height_to_gain));
   } while (height_to_gain > height{});
 
   // final glide
-  pos = final_glide(start_ts, pos, g, t);
+  add_phase(flight_phase::type::final_glide, pos, final_glide(pos, g, t));
+  return res;
+}
+
+std::vector<flight_estimate> simulate(timestamp start_ts, std::span<const glider> gliders,
+                                      std::span<const weather> conditions, std::span<const task> tasks,
+                                      const safety& s, const aircraft_tow& at, thread_pool& pool)
+{
+  std::vector<flight_estimate> res(gliders.size() * conditions.size() * tasks.size());
+  pool.parallel_for_each(res.size(), [&](std::size_t i) {
+    const std::size_t k = i % tasks.size();
+    const std::size_t j = i / tasks.size() % conditions.size();
+    const std::size_t g = i / tasks.size() / conditions.size();
+    res[i] = simulate(start_ts, gliders[g], conditions[j], tasks[k], s, at);
+  });
+  return res;
+}
+
+void print(const flight_estimate& e)
+{
+  std::cout << MP_UNITS_STD_FMT::format("| {:<12} | {:^28} | {:^26} | {:^21} |\n", "Flight phase", "Duration",
+                                        "Distance", "Height");
+  std::cout << MP_UNITS_STD_FMT::format("|{0:-^14}|{0:-^30}|{0:-^28}|{0:-^23}|\n", "");
+
+  for (const flight_phase& p : e.phases)
+    std::cout << MP_UNITS_STD_FMT::format(
+      "| {:<12} | {:>9%.1Q %q} (Total: {:>9%.1Q %q}) | {:>8%.1Q %q} (Total: {:>8%.1Q %q}) | {:>7%.0Q %q} "
+      "({:>6%.0Q %q}) |\n",
+      to_string_view(p.kind), value_cast<si::minute>(p.end.ts - p.begin.ts),
+      value_cast<si::minute>(p.end.ts - e.start_ts), p.end.dist - p.begin.dist, p.end.dist, p.end.alt - p.begin.alt,
+      p.end.alt);
+}
+
+void estimate(timestamp start_ts, const glider& g, const weather& w, const task& t, const safety& s,
+              const aircraft_tow& at)
+{
+  print(simulate(start_ts, g, w, t, s, at));
 }
 
 }  // namespace glide_computer
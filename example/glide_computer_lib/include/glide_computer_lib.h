@@ -23,6 +23,9 @@
 #pragma once
 
 #include "geographic.h"
+#include "spatial_index.h"
+#include "terrain_grid.h"
+#include "thread_pool.h"
 #include <mp-units/chrono.h>
 #include <mp-units/math.h>  // IWYU pragma: keep
 #include <mp-units/quantity_point.h>
@@ -33,7 +36,9 @@
 #include <iterator>
 #include <ostream>
 #include <ranges>
+#include <span>
 #include <string>  // IWYU pragma: keep
+#include <string_view>
 #include <vector>
 
 // An example of a really simplified tactical glide computer
@@ -95,19 +100,65 @@ struct waypoint {
   geographic::msl_altitude alt;
 };
 
+// a database of waypoints (e.g. turnpoints and airfields) indexed for the lookups around a position
+class waypoint_database {
+public:
+  struct neighbour {
+    const waypoint* wpt;
+    distance dist;
+  };
+
+  explicit waypoint_database(std::vector<waypoint> wpts);
+  waypoint_database(std::vector<waypoint> wpts, thread_pool& pool);
+
+  const std::vector<waypoint>& get_waypoints() const { return waypoints_; }
+
+  // the waypoints not farther than `radius` from `pos` ordered by the increasing distance
+  std::vector<neighbour> within(const geographic::position<long double>& pos, distance radius) const;
+
+  // `count` waypoints closest to `pos` ordered by the increasing distance
+  std::vector<neighbour> nearest(const geographic::position<long double>& pos, std::size_t count) const;
+
+private:
+  std::vector<waypoint> waypoints_;
+  geographic::spatial_index index_;
+
+  std::vector<neighbour> to_neighbours(const std::vector<geographic::spatial_index::neighbour>& found) const;
+};
+
 class task {
 public:
   using waypoints = std::vector<waypoint>;
 
+  // precomputed geometry of the path between two consecutive waypoints of a task
   class leg {
-    const waypoint* begin_;
-    const waypoint* end_;
-    distance length_ = geographic::spherical_distance(begin().pos, end().pos);
+    std::size_t begin_idx_;
+    distance offset_;
+    distance length_;
+    geographic::bearing bearing_;
+    geographic::msl_altitude begin_alt_;
+    decltype(height{} / distance{}) slope_;
   public:
-    leg(const waypoint& b, const waypoint& e) noexcept : begin_(&b), end_(&e) {}
-    constexpr const waypoint& begin() const { return *begin_; };
-    constexpr const waypoint& end() const { return *end_; }
+    leg(std::size_t begin_idx, const waypoint& b, const waypoint& e, distance offset) :
+        begin_idx_(begin_idx),
+        offset_(offset),
+        length_(geographic::spherical_distance(b.pos, e.pos)),
+        bearing_(geographic::initial_bearing(b.pos, e.pos)),
+        begin_alt_(b.alt),
+        slope_((e.alt - b.alt) / length_)
+    {
+    }
+    constexpr std::size_t begin_index() const { return begin_idx_; }
+    constexpr std::size_t end_index() const { return begin_idx_ + 1; }
     constexpr distance get_distance() const { return length_; }
+    // distance from the start of the task to the beginning of the leg
+    constexpr distance get_offset() const { return offset_; }
+    constexpr geographic::bearing get_bearing() const { return bearing_; }
+    // ground level changing linearly between the waypoints at the distance `dist` from the start of the task
+    constexpr geographic::msl_altitude terrain_level_alt(distance dist) const
+    {
+      return begin_alt_ + quantity_cast<mp_units::isq::height>(slope_ * (dist - offset_));
+    }
   };
   using legs = std::vector<leg>;
 
@@ -127,24 +178,23 @@ public:
 
   distance get_distance() const { return length_; }
 
-  distance get_leg_dist_offset(std::size_t leg_index) const
-  {
-    return leg_index == 0 ? distance{} : leg_total_distances_[leg_index - 1];
-  }
-  std::size_t get_leg_index(distance dist) const
+  distance get_leg_dist_offset(std::size_t leg_index) const { return legs_[leg_index].get_offset(); }
+
+  // `hint` is a leg at or before the searched one (e.g. the current leg of a flight) which makes
+  // the lookup constant time for a flight progressing along the task
+  std::size_t get_leg_index(distance dist, std::size_t hint = 0) const
   {
-    return static_cast<std::size_t>(
-      std::ranges::distance(leg_total_distances_.cbegin(), std::ranges::lower_bound(leg_total_distances_, dist)));
+    if (hint >= legs_.size() || legs_[hint].get_offset() > dist) hint = 0;
+    while (hint + 1 < legs_.size() && legs_[hint].get_offset() + legs_[hint].get_distance() < dist) ++hint;
+    return hint;
   }
 
 private:
   waypoints waypoints_;
   legs legs_ = make_legs(waypoints_);
-  std::vector<distance> leg_total_distances_ = make_leg_total_distances(legs_);
-  distance length_ = leg_total_distances_.back();
+  distance length_ = legs_.back().get_offset() + legs_.back().get_distance();
 
   static legs make_legs(const task::waypoints& wpts);
-  static std::vector<distance> make_leg_total_distances(const legs& legs);
 };
 
 struct safety {
@@ -165,6 +215,10 @@ struct flight_point {
 
 geographic::msl_altitude terrain_level_alt(const task& t, const flight_point& pos);
 
+// ground level taken from the terrain model at the position of the flight along the task
+geographic::msl_altitude terrain_level_alt(const task& t, const flight_point& pos,
+                                           const geographic::terrain_grid& terrain);
+
 constexpr height agl(geographic::msl_altitude glider_alt, geographic::msl_altitude terrain_level)
 {
   return glider_alt - terrain_level;
@@ -179,6 +233,35 @@ inline mp_units::quantity<mp_units::isq::length[mp_units::si::kilo<mp_units::si:
 distance glide_distance(const flight_point& pos, const glider& g, const task& t, const safety& s,
                         geographic::msl_altitude ground_alt);
 
+struct flight_phase {
+  enum class type { tow, glide, circle, final_glide };
+
+  type kind;
+  flight_point begin;
+  flight_point end;
+};
+
+std::string_view to_string_view(flight_phase::type t);
+
+struct flight_estimate {
+  timestamp start_ts;
+  std::vector<flight_phase> phases;
+
+  duration get_duration() const { return phases.empty() ? duration::zero() : phases.back().end.ts - start_ts; }
+};
+
+flight_estimate simulate(timestamp start_ts, const glider& g, const weather& w, const task& t, const safety& s,
+                         const aircraft_tow& at);
+
+// Simulates every combination of a glider, weather and task on the threads of `pool`.
+// The estimate of `gliders[i]`, `conditions[j]` and `tasks[k]` is stored at
+// `(i * conditions.size() + j) * tasks.size() + k`.
+std::vector<flight_estimate> simulate(timestamp start_ts, std::span<const glider> gliders,
+                                      std::span<const weather> conditions, std::span<const task> tasks,
+                                      const safety& s, const aircraft_tow& at, thread_pool& pool);
+
+void print(const flight_estimate& e);
+
 void estimate(timestamp start_ts, const glider& g, const weather& w, const task& t, const safety& s,
               const aircraft_tow& at);
 
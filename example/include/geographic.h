@@ -31,10 +31,18 @@
 #include <mp-units/quantity_point.h>
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si/units.h>
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <compare>
+#include <cstddef>
 #include <limits>
 #include <numbers>
 #include <ostream>
+#include <ranges>
+#include <span>
+#include <vector>
 
 namespace geographic {
 
@@ -70,6 +78,8 @@ inline constexpr struct prime_meridian : mp_units::absolute_point_origin<mp_unit
 } prime_meridian;
 
 
+// every construction of the representation is validated, including the results proven to be in range
+// (`check_always`); only the positions computed by `destination()` skip it with `validated`
 template<typename T = double>
 using latitude = mp_units::quantity_point<mp_units::si::degree, equator, ranged_representation<T, -90, 90>>;
 
@@ -169,11 +179,27 @@ struct position {
   longitude<T> lon;
 };
 
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_position = false;
+
+template<typename T>
+inline constexpr bool is_position<position<T>> = true;
+
+}  // namespace detail
+
+template<typename R>
+concept PositionRange = std::ranges::random_access_range<R> && std::ranges::sized_range<R> &&
+                        detail::is_position<std::ranges::range_value_t<R>>;
+
+inline constexpr mp_units::quantity earth_radius =
+  6'371 * mp_units::isq::radius[mp_units::si::kilo<mp_units::si::metre>];
+
 template<typename T>
 distance spherical_distance(position<T> from, position<T> to)
 {
   using namespace mp_units;
-  constexpr quantity earth_radius = 6'371 * isq::radius[si::kilo<si::metre>];
 
   using isq::sin, isq::cos, isq::asin, isq::acos;
 
@@ -201,4 +227,204 @@ distance spherical_distance(position<T> from, position<T> to)
   }
 }
 
+namespace detail {
+
+// a point on the unit sphere; distances between such points need no trigonometry besides the final `asin`
+using unit_vector = std::array<distance::rep, 3>;
+
+inline constexpr distance::rep deg_to_rad = std::numbers::pi_v<distance::rep> / 180;
+
+// latitude and longitude in radians
+template<typename T>
+[[nodiscard]] std::array<distance::rep, 2> to_radians(const position<T>& p)
+{
+  using namespace mp_units;
+  using rep = distance::rep;
+  const rep lat = static_cast<rep>(static_cast<T>(p.lat.quantity_from(equator).numerical_value_in(si::degree)));
+  const rep lon = static_cast<rep>(static_cast<T>(p.lon.quantity_from(prime_meridian).numerical_value_in(si::degree)));
+  return {lat * deg_to_rad, lon * deg_to_rad};
+}
+
+template<typename T>
+[[nodiscard]] position<T> from_radians(distance::rep lat, distance::rep lon)
+{
+  using namespace mp_units;
+  using rep = distance::rep;
+  const rep lat_deg = std::clamp(lat / deg_to_rad, rep{-90}, rep{90});
+  const rep lon_deg = std::remainder(lon / deg_to_rad, rep{360});
+  // both values are in range by construction
+  return {equator + ranged_representation<T, -90, 90>{static_cast<T>(lat_deg), validated} * si::degree,
+          prime_meridian + ranged_representation<T, -180, 180>{static_cast<T>(lon_deg), validated} * si::degree};
+}
+
+template<typename T>
+[[nodiscard]] unit_vector to_unit_vector(const position<T>& p)
+{
+  const auto [lat, lon] = to_radians(p);
+  const distance::rep cos_lat = std::cos(lat);
+  return {cos_lat * std::cos(lon), cos_lat * std::sin(lon), std::sin(lat)};
+}
+
+[[nodiscard]] inline distance::rep squared_chord(const unit_vector& a, const unit_vector& b)
+{
+  const distance::rep dx = a[0] - b[0];
+  const distance::rep dy = a[1] - b[1];
+  const distance::rep dz = a[2] - b[2];
+  return dx * dx + dy * dy + dz * dz;
+}
+
+// the great-circle distance subtending a chord between two points on the unit sphere; unlike the spherical
+// law of cosines it stays accurate for nearby points
+[[nodiscard]] inline distance::rep chord_to_distance(distance::rep squared_chord)
+{
+  using rep = distance::rep;
+  const rep half_chord = std::min(std::sqrt(squared_chord) / 2, rep{1});
+  return 2 * std::asin(half_chord) * earth_radius.numerical_value_in(distance::unit);
+}
+
+// the inverse of `chord_to_distance()`
+[[nodiscard]] inline distance::rep distance_to_squared_chord(distance d)
+{
+  using rep = distance::rep;
+  const rep central_angle = d.numerical_value_in(distance::unit) / earth_radius.numerical_value_in(distance::unit);
+  if (central_angle >= std::numbers::pi_v<rep>) return 4;
+  const rep chord = 2 * std::sin(central_angle / 2);
+  return chord * chord;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Positions cached as unit vectors for repeated distance queries
+ *
+ * The trigonometric terms of every position are evaluated once on insertion and stored as
+ * structure-of-arrays columns so that the distance kernels are plain arithmetic loops.
+ */
+class spherical_points {
+  std::vector<distance::rep> x_;
+  std::vector<distance::rep> y_;
+  std::vector<distance::rep> z_;
+
+  template<typename T>
+  friend void spherical_distance(position<T> from, const spherical_points& to, std::span<distance> result);
+public:
+  spherical_points() = default;
+
+  template<PositionRange R>
+  explicit spherical_points(const R& positions)
+  {
+    reserve(std::ranges::size(positions));
+    for (const auto& p : positions) push_back(p);
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return x_.size(); }
+
+  void reserve(std::size_t count)
+  {
+    x_.reserve(count);
+    y_.reserve(count);
+    z_.reserve(count);
+  }
+
+  template<typename T>
+  void push_back(const position<T>& p)
+  {
+    const auto [x, y, z] = detail::to_unit_vector(p);
+    x_.push_back(x);
+    y_.push_back(y);
+    z_.push_back(z);
+  }
+};
+
+/**
+ * @brief Computes the distances between the corresponding elements of two ranges of positions
+ *
+ * Unlike the scalar overload, the distances are computed in `distance::rep` (`double`) precision
+ * regardless of the representation type of the positions.
+ *
+ * @param result the output range of at least `std::ranges::size(from)` elements
+ */
+template<PositionRange From, PositionRange To>
+void spherical_distance(const From& from, const To& to, std::span<distance> result)
+{
+  const std::size_t count = std::ranges::size(from);
+  gsl_Expects(std::ranges::size(to) == count && result.size() >= count);
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto a = detail::to_unit_vector(std::ranges::begin(from)[static_cast<std::ptrdiff_t>(i)]);
+    const auto b = detail::to_unit_vector(std::ranges::begin(to)[static_cast<std::ptrdiff_t>(i)]);
+    result[i] = detail::chord_to_distance(detail::squared_chord(a, b)) * distance::reference;
+  }
+}
+
+/**
+ * @brief Computes the distances from one position to every element of a range of positions
+ *
+ * @param result the output range of at least `std::ranges::size(to)` elements
+ */
+template<typename T, PositionRange R>
+void spherical_distance(position<T> from, const R& to, std::span<distance> result)
+{
+  gsl_Expects(result.size() >= std::ranges::size(to));
+  const auto a = detail::to_unit_vector(from);
+  std::size_t i = 0;
+  for (const auto& p : to)
+    result[i++] = detail::chord_to_distance(detail::squared_chord(a, detail::to_unit_vector(p))) * distance::reference;
+}
+
+/**
+ * @brief Computes the distances from one position to every cached position
+ *
+ * @param result the output range of at least `to.size()` elements
+ */
+template<typename T>
+void spherical_distance(position<T> from, const spherical_points& to, std::span<distance> result)
+{
+  gsl_Expects(result.size() >= to.size());
+  const auto [ax, ay, az] = detail::to_unit_vector(from);
+  const distance::rep* const x = to.x_.data();
+  const distance::rep* const y = to.y_.data();
+  const distance::rep* const z = to.z_.data();
+  for (std::size_t i = 0; i < to.size(); ++i) {
+    const distance::rep dx = ax - x[i];
+    const distance::rep dy = ay - y[i];
+    const distance::rep dz = az - z[i];
+    result[i] = detail::chord_to_distance(dx * dx + dy * dy + dz * dz) * distance::reference;
+  }
+}
+
+using bearing = mp_units::quantity<mp_units::isq::angular_measure[mp_units::si::degree]>;
+
+/**
+ * @brief The initial bearing of the great-circle path from one position to another
+ *
+ * @return the bearing clockwise from the true north in the range `(-180, 180]` degrees
+ */
+template<typename T>
+bearing initial_bearing(position<T> from, position<T> to)
+{
+  using std::sin, std::cos;
+  const auto [lat1, lon1] = detail::to_radians(from);
+  const auto [lat2, lon2] = detail::to_radians(to);
+  const distance::rep angle =
+    std::atan2(sin(lon2 - lon1) * cos(lat2), cos(lat1) * sin(lat2) - sin(lat1) * cos(lat2) * cos(lon2 - lon1));
+  return angle / detail::deg_to_rad * bearing::reference;
+}
+
+/**
+ * @brief The position reached after travelling the distance `d` along the great circle starting
+ *        with the bearing `b`
+ */
+template<typename T>
+position<T> destination(position<T> from, bearing b, distance d)
+{
+  using std::sin, std::cos;
+  const auto [lat1, lon1] = detail::to_radians(from);
+  const distance::rep theta = b.numerical_value_in(mp_units::si::degree) * detail::deg_to_rad;
+  const distance::rep delta = d.numerical_value_in(distance::unit) / earth_radius.numerical_value_in(distance::unit);
+  const distance::rep lat2 = std::asin(sin(lat1) * cos(delta) + cos(lat1) * sin(delta) * cos(theta));
+  const distance::rep lon2 =
+    lon1 + std::atan2(sin(theta) * sin(delta) * cos(lat1), cos(delta) - sin(lat1) * sin(lat2));
+  return detail::from_radians<T>(lat2, lon2);
+}
+
 }  // namespace geographic
@@ -26,43 +26,65 @@
 #include <mp-units/bits/external/hacks.h>
 #include <mp-units/bits/fmt.h>
 #include <mp-units/customization_points.h>
-#include <algorithm>
 #include <concepts>
+#include <numeric>
 #include <type_traits>
+#include <utility>
 
 template<std::movable T, MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Min,
          MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Max>
-inline constexpr auto is_in_range = [](const auto& v) { return std::clamp(v, T{Min}, T{Max}) == v; };
+inline constexpr auto is_in_range = [](const auto& v) { return T{Min} <= v && v <= T{Max}; };
 
 template<std::movable T, MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Min,
          MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Max>
 using is_in_range_t = decltype(is_in_range<T, Min, Max>);
 
 template<std::movable T, MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Min,
-         MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Max>
-class ranged_representation : public validated_type<T, is_in_range_t<T, Min, Max>> {
+         MP_UNITS_CONSTRAINED_NTTP_WORKAROUND(std::convertible_to<T>) auto Max, ValidationPolicy Policy = check_always>
+class ranged_representation : public validated_type<T, is_in_range_t<T, Min, Max>, Policy> {
 public:
-  using validated_type<T, is_in_range_t<T, Min, Max>>::validated_type;
-  constexpr ranged_representation() : validated_type<T, is_in_range_t<T, Min, Max>>(T{}) {}
+  using validated_type<T, is_in_range_t<T, Min, Max>, Policy>::validated_type;
+  constexpr ranged_representation() : validated_type<T, is_in_range_t<T, Min, Max>, Policy>(T{}) {}
 
   [[nodiscard]] constexpr ranged_representation operator-() const
     requires requires(T t) { -t; }
   {
-    return ranged_representation(-this->value());
+    // the negation of a value from a symmetric range is always in range
+    if constexpr (T{Min} == -T{Max})
+      return proven(-this->value());
+    else
+      return ranged_representation(-this->value());
+  }
+
+  // the midpoint of two values is always in range
+  [[nodiscard]] friend constexpr ranged_representation midpoint(const ranged_representation& lhs,
+                                                                const ranged_representation& rhs)
+    requires std::is_arithmetic_v<T>
+  {
+    return proven(std::midpoint(lhs.value(), rhs.value()));
+  }
+
+private:
+  [[nodiscard]] static constexpr ranged_representation proven(T value)
+  {
+    if constexpr (Policy::check_proven_results)
+      return ranged_representation(std::move(value));
+    else
+      return ranged_representation(std::move(value), validated);
   }
 };
 
-template<typename T, auto Min, auto Max>
-inline constexpr bool mp_units::is_scalar<ranged_representation<T, Min, Max>> = mp_units::is_scalar<T>;
+template<typename T, auto Min, auto Max, typename Policy>
+inline constexpr bool mp_units::is_scalar<ranged_representation<T, Min, Max, Policy>> = mp_units::is_scalar<T>;
 
-template<typename T, auto Min, auto Max>
-inline constexpr bool mp_units::treat_as_floating_point<ranged_representation<T, Min, Max>> =
+template<typename T, auto Min, auto Max, typename Policy>
+inline constexpr bool mp_units::treat_as_floating_point<ranged_representation<T, Min, Max, Policy>> =
   mp_units::treat_as_floating_point<T>;
 
-template<typename T, auto Min, auto Max>
-struct MP_UNITS_STD_FMT::formatter<ranged_representation<T, Min, Max>> : formatter<T> {
+template<typename T, auto Min, auto Max, typename Policy>
+struct MP_UNITS_STD_FMT::formatter<ranged_representation<T, Min, Max, Policy>> : formatter<T> {
   template<typename FormatContext>
-  auto format(const ranged_representation<T, Min, Max>& v, FormatContext& ctx)
+  auto format(const ranged_representation<T, Min, Max, Policy>& v, FormatContext& ctx)
   {
     return formatter<T>::format(v.value(), ctx);
   }
@@ -0,0 +1,228 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "geographic.h"
+#include "thread_pool.h"
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace geographic {
+
+/**
+ * @brief A static k-d tree over positions for radius and nearest neighbour queries
+ *
+ * Positions are indexed as unit vectors in 3D space where the chord length grows monotonically with
+ * the great-circle distance, so the tree needs no special handling of the poles or the antimeridian.
+ * Nodes are stored in a single flat array in the layout of a balanced tree: the root of every
+ * subrange is its middle element, and its left and right subtrees occupy the two halves around it.
+ */
+class spatial_index {
+public:
+  struct neighbour {
+    std::size_t index;  // the position of the point in the range the index was built from
+    distance dist;
+  };
+
+private:
+  struct node {
+    detail::unit_vector point;
+    std::size_t index;
+    std::uint8_t axis;
+  };
+
+  struct candidate {
+    distance::rep squared_chord;
+    std::size_t index;
+  };
+
+  std::vector<node> nodes_;
+
+  template<PositionRange R>
+  [[nodiscard]] static std::vector<node> make_nodes(const R& positions)
+  {
+    std::vector<node> nodes;
+    nodes.reserve(std::ranges::size(positions));
+    for (std::size_t i = 0; const auto& p : positions) nodes.push_back({detail::to_unit_vector(p), i++, 0});
+    return nodes;
+  }
+
+  // places the root of the subtree in the middle of the range, split along the axis of the widest extent
+  static void split(std::span<node> nodes)
+  {
+    using rep = distance::rep;
+    detail::unit_vector lo;
+    detail::unit_vector hi;
+    lo.fill(std::numeric_limits<rep>::max());
+    hi.fill(std::numeric_limits<rep>::lowest());
+    for (const node& n : nodes)
+      for (std::size_t a = 0; a < 3; ++a) {
+        lo[a] = std::min(lo[a], n.point[a]);
+        hi[a] = std::max(hi[a], n.point[a]);
+      }
+    std::uint8_t axis = 0;
+    for (std::uint8_t a = 1; a < 3; ++a)
+      if (hi[a] - lo[a] > hi[axis] - lo[axis]) axis = a;
+
+    const auto mid = nodes.begin() + static_cast<std::ptrdiff_t>(nodes.size() / 2);
+    std::ranges::nth_element(nodes, mid, {}, [axis](const node& n) { return n.point[axis]; });
+    mid->axis = axis;
+  }
+
+  static void build(std::span<node> nodes)
+  {
+    if (nodes.size() <= 1) return;
+    split(nodes);
+    const std::size_t mid = nodes.size() / 2;
+    build(nodes.first(mid));
+    build(nodes.subspan(mid + 1));
+  }
+
+  static void search_within(std::span<const node> nodes, const detail::unit_vector& center,
+                            distance::rep max_squared_chord, std::vector<candidate>& result)
+  {
+    while (!nodes.empty()) {
+      const std::size_t mid = nodes.size() / 2;
+      const node& n = nodes[mid];
+      const distance::rep d = detail::squared_chord(n.point, center);
+      if (d <= max_squared_chord) result.push_back({d, n.index});
+
+      const distance::rep offset = center[n.axis] - n.point[n.axis];
+      const auto left = nodes.first(mid);
+      const auto right = nodes.subspan(mid + 1);
+      if (offset * offset <= max_squared_chord)
+        search_within(offset < 0 ? right : left, center, max_squared_chord, result);
+      nodes = offset < 0 ? left : right;
+    }
+  }
+
+  // `result` is a max-heap of at most `count` closest candidates found so far
+  static void search_nearest(std::span<const node> nodes, const detail::unit_vector& center, std::size_t count,
+                             std::vector<candidate>& result)
+  {
+    if (nodes.empty()) return;
+    const std::size_t mid = nodes.size() / 2;
+    const node& n = nodes[mid];
+    const distance::rep d = detail::squared_chord(n.point, center);
+    if (result.size() < count) {
+      result.push_back({d, n.index});
+      std::ranges::push_heap(result, {}, &candidate::squared_chord);
+    } else if (d < result.front().squared_chord) {
+      std::ranges::pop_heap(result, {}, &candidate::squared_chord);
+      result.back() = {d, n.index};
+      std::ranges::push_heap(result, {}, &candidate::squared_chord);
+    }
+
+    const distance::rep offset = center[n.axis] - n.point[n.axis];
+    const auto left = nodes.first(mid);
+    const auto right = nodes.subspan(mid + 1);
+    search_nearest(offset < 0 ? left : right, center, count, result);
+    if (result.size() < count || offset * offset < result.front().squared_chord)
+      search_nearest(offset < 0 ? right : left, center, count, result);
+  }
+
+  [[nodiscard]] static std::vector<neighbour> to_neighbours(std::vector<candidate>& candidates)
+  {
+    std::ranges::sort(candidates, {}, &candidate::squared_chord);
+    std::vector<neighbour> result;
+    result.reserve(candidates.size());
+    for (const candidate& c : candidates)
+      result.push_back({c.index, detail::chord_to_distance(c.squared_chord) * distance::reference});
+    return result;
+  }
+
+public:
+  spatial_index() = default;
+
+  template<PositionRange R>
+  explicit spatial_index(const R& positions) : nodes_(make_nodes(positions))
+  {
+    build(nodes_);
+  }
+
+  /**
+   * @brief Builds the index with the independent subtrees distributed over a thread pool
+   */
+  template<PositionRange R>
+  spatial_index(const R& positions, thread_pool& pool) : nodes_(make_nodes(positions))
+  {
+    // split the top levels serially until there are enough subtrees to keep all the threads busy
+    std::vector<std::span<node>> subtrees{std::span(nodes_)};
+    while (subtrees.size() < 4 * pool.size()) {
+      std::vector<std::span<node>> next;
+      for (const auto& s : subtrees) {
+        if (s.size() <= 1) continue;
+        split(s);
+        next.push_back(s.first(s.size() / 2));
+        next.push_back(s.subspan(s.size() / 2 + 1));
+      }
+      if (next.empty()) return;
+      subtrees = std::move(next);
+    }
+    pool.parallel_for(subtrees.size(), 1, [&](std::size_t first, std::size_t last) {
+      for (std::size_t i = first; i < last; ++i) build(subtrees[i]);
+    });
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return nodes_.size(); }
+  [[nodiscard]] bool empty() const noexcept { return nodes_.empty(); }
+
+  /**
+   * @brief Finds all the positions not farther than `radius` from `center`
+   *
+   * @return the neighbours ordered by the increasing distance
+   */
+  template<typename T>
+  [[nodiscard]] std::vector<neighbour> within(position<T> center, distance radius) const
+  {
+    gsl_Expects(radius >= distance::zero());
+    std::vector<candidate> candidates;
+    search_within(nodes_, detail::to_unit_vector(center), detail::distance_to_squared_chord(radius), candidates);
+    return to_neighbours(candidates);
+  }
+
+  /**
+   * @brief Finds `count` positions closest to `center`
+   *
+   * @return the neighbours ordered by the increasing distance
+   */
+  template<typename T>
+  [[nodiscard]] std::vector<neighbour> nearest(position<T> center, std::size_t count) const
+  {
+    if (count == 0) return {};
+    std::vector<candidate> candidates;
+    candidates.reserve(std::min(count, size()));
+    search_nearest(nodes_, detail::to_unit_vector(center), count, candidates);
+    return to_neighbours(candidates);
+  }
+};
+
+}  // namespace geographic
@@ -0,0 +1,233 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "geographic.h"
+#include <gsl/gsl-lite.hpp>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/si/units.h>
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GEOGRAPHIC_HAS_MMAP 1
+#else
+#define GEOGRAPHIC_HAS_MMAP 0
+#endif
+
+namespace geographic {
+
+namespace detail {
+
+// the contents of a read-only file; memory-mapped where the platform supports it
+class file_contents {
+  const std::byte* data_ = nullptr;
+  std::size_t size_ = 0;
+#if !GEOGRAPHIC_HAS_MMAP
+  std::vector<std::byte> buffer_;
+#endif
+public:
+  explicit file_contents(const std::filesystem::path& path)
+  {
+#if GEOGRAPHIC_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::system_error(errno, std::generic_category(), path.string());
+    struct stat st {};
+    if (::fstat(fd, &st) != 0) {
+      const int err = errno;
+      ::close(fd);
+      throw std::system_error(err, std::generic_category(), path.string());
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    void* const addr = size_ > 0 ? ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    const int err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) throw std::system_error(err, std::generic_category(), path.string());
+    data_ = static_cast<const std::byte*>(addr);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("cannot open " + path.string());
+    buffer_.resize(static_cast<std::size_t>(std::filesystem::file_size(path)));
+    file.read(reinterpret_cast<char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  file_contents(const file_contents&) = delete;
+  file_contents& operator=(const file_contents&) = delete;
+
+  ~file_contents()
+  {
+#if GEOGRAPHIC_HAS_MMAP
+    if (data_) ::munmap(const_cast<std::byte*>(data_), size_);
+#endif
+  }
+
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept { return {data_, size_}; }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A terrain elevation model sampled on a uniform latitude/longitude grid
+ *
+ * Elevations are looked up in constant time with a bilinear interpolation between the four surrounding
+ * samples; positions outside of the grid take the elevation of its nearest edge.
+ *
+ * The binary file format consists of a header followed by `rows * columns` elevations in metres stored
+ * as native-endian `float`s in the row-major order starting from the south-west corner. Files are
+ * memory-mapped so that large models do not need to be read upfront.
+ */
+class terrain_grid {
+public:
+  using angle = mp_units::quantity<mp_units::si::degree>;
+
+  struct file_header {
+    std::array<char, 8> magic;
+    std::uint32_t rows;
+    std::uint32_t columns;
+    double south;    // latitude of the first row in degrees
+    double west;     // longitude of the first column in degrees
+    double spacing;  // distance between neighbouring samples in degrees
+
+    [[nodiscard]] bool valid() const
+    {
+      return rows > 0 && columns > 0 && std::isfinite(south) && std::isfinite(west) && std::isfinite(spacing) &&
+             spacing > 0;
+    }
+  };
+  static constexpr std::array<char, 8> magic = {'M', 'P', 'U', 'T', 'E', 'R', 'R', '1'};
+
+private:
+  file_header header_{};
+  std::shared_ptr<const void> storage_;
+  const float* elevations_ = nullptr;
+
+  [[nodiscard]] distance::rep sample(std::size_t row, std::size_t column) const
+  {
+    return static_cast<distance::rep>(elevations_[row * header_.columns + column]);
+  }
+
+public:
+  /**
+   * @brief Creates a grid from elevations in metres stored in the row-major order from the south-west corner
+   */
+  template<typename T>
+  terrain_grid(position<T> south_west, angle spacing, std::size_t rows, std::size_t columns,
+               std::vector<float> elevations)
+  {
+    gsl_Expects(rows > 0 && columns > 0 && elevations.size() == rows * columns);
+    gsl_Expects(spacing > angle::zero() && std::isfinite(spacing.numerical_value_in(mp_units::si::degree)));
+    const auto [south, west] = detail::to_radians(south_west);
+    header_.magic = magic;
+    header_.rows = static_cast<std::uint32_t>(rows);
+    header_.columns = static_cast<std::uint32_t>(columns);
+    header_.south = south / detail::deg_to_rad;
+    header_.west = west / detail::deg_to_rad;
+    header_.spacing = spacing.numerical_value_in(mp_units::si::degree);
+    auto data = std::make_shared<const std::vector<float>>(std::move(elevations));
+    elevations_ = data->data();
+    storage_ = std::move(data);
+  }
+
+  /**
+   * @brief Maps a grid stored in a binary file
+   */
+  [[nodiscard]] static terrain_grid load(const std::filesystem::path& path)
+  {
+    auto file = std::make_shared<const detail::file_contents>(path);
+    const auto bytes = file->bytes();
+    terrain_grid res;
+    if (bytes.size() < sizeof(file_header)) throw std::runtime_error("truncated terrain file " + path.string());
+    std::memcpy(&res.header_, bytes.data(), sizeof(file_header));
+    if (res.header_.magic != magic) throw std::runtime_error("not a terrain file " + path.string());
+    // the same preconditions as of the constructor; the lookups rely on them
+    if (!res.header_.valid()) throw std::runtime_error("invalid terrain file header " + path.string());
+    const std::size_t count = std::size_t{res.header_.rows} * res.header_.columns;
+    if ((bytes.size() - sizeof(file_header)) / sizeof(float) < count)
+      throw std::runtime_error("truncated terrain file " + path.string());
+    // the mapping is page-aligned and the header size is a multiple of the alignment of `float`
+    static_assert(sizeof(file_header) % alignof(float) == 0);
+    res.elevations_ = reinterpret_cast<const float*>(bytes.data() + sizeof(file_header));
+    res.storage_ = std::move(file);
+    return res;
+  }
+
+  void save(const std::filesystem::path& path) const
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) throw std::runtime_error("cannot create " + path.string());
+    file.write(reinterpret_cast<const char*>(&header_), sizeof(file_header));
+    file.write(reinterpret_cast<const char*>(elevations_),
+               static_cast<std::streamsize>(std::size_t{header_.rows} * header_.columns * sizeof(float)));
+    if (!file) throw std::runtime_error("cannot write " + path.string());
+  }
+
+  [[nodiscard]] std::size_t rows() const noexcept { return header_.rows; }
+  [[nodiscard]] std::size_t columns() const noexcept { return header_.columns; }
+
+  template<typename T>
+  [[nodiscard]] msl_altitude elevation(position<T> pos) const
+  {
+    using rep = distance::rep;
+    const auto [lat, lon] = detail::to_radians(pos);
+    const rep row = std::clamp((lat / detail::deg_to_rad - header_.south) / header_.spacing, rep{0},
+                               static_cast<rep>(header_.rows - 1));
+    const rep column = std::clamp((lon / detail::deg_to_rad - header_.west) / header_.spacing, rep{0},
+                                  static_cast<rep>(header_.columns - 1));
+    const auto r0 = static_cast<std::size_t>(row);
+    const auto c0 = static_cast<std::size_t>(column);
+    const std::size_t r1 = std::min<std::size_t>(r0 + 1, header_.rows - 1);
+    const std::size_t c1 = std::min<std::size_t>(c0 + 1, header_.columns - 1);
+    const rep fr = row - static_cast<rep>(r0);
+    const rep fc = column - static_cast<rep>(c0);
+    const rep south = sample(r0, c0) + fc * (sample(r0, c1) - sample(r0, c0));
+    const rep north = sample(r1, c0) + fc * (sample(r1, c1) - sample(r1, c0));
+    return mean_sea_level + (south + fr * (north - south)) * mp_units::isq::altitude[mp_units::si::metre];
+  }
+
+private:
+  terrain_grid() = default;
+};
+
+}  // namespace geographic
@@ -0,0 +1,244 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <gsl/gsl-lite.hpp>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief A fixed-size pool of worker threads running data-parallel loops
+ *
+ * `parallel_for()` splits an index range into chunks which are claimed dynamically by the workers
+ * and the calling thread, so faster threads pick up more chunks. `parallel_for_each()` balances
+ * elements of uneven cost with work stealing.
+ */
+class thread_pool {
+  // a loop run by all the participating threads; `execute` is called once by every participant
+  struct job {
+    void* context;
+    void (*execute)(void* context, std::size_t participant);
+  };
+
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::condition_variable work_done_;
+  job* current_ = nullptr;
+  std::size_t participants_ = 0;
+  std::uint64_t generation_ = 0;
+  std::size_t active_ = 0;
+  bool stop_ = false;
+  std::vector<std::thread> workers_;
+
+  template<typename F>
+  struct chunked_loop {
+    F& f;
+    std::size_t count;
+    std::size_t grain;
+    std::atomic<std::size_t> next{0};
+
+    static void execute(void* context, std::size_t)
+    {
+      auto& l = *static_cast<chunked_loop*>(context);
+      for (;;) {
+        const std::size_t first = l.next.fetch_add(l.grain, std::memory_order_relaxed);
+        if (first >= l.count) return;
+        l.f(first, std::min(first + l.grain, l.count));
+      }
+    }
+  };
+
+  // every participant owns a range of indices `[begin, end)` packed into a single word; the owner takes
+  // indices from the front while the others steal the back half of the remaining range once they run out
+  template<typename F>
+  struct stealing_loop {
+    struct alignas(64) slot {
+      std::atomic<std::uint64_t> range;
+    };
+
+    F& f;
+    std::size_t participants;
+    std::unique_ptr<slot[]> slots;
+
+    static constexpr std::uint64_t pack(std::uint64_t begin, std::uint64_t end) { return begin << 32 | end; }
+    static constexpr std::uint64_t begin(std::uint64_t range) { return range >> 32; }
+    static constexpr std::uint64_t end(std::uint64_t range) { return range & 0xFFFF'FFFF; }
+
+    stealing_loop(F& func, std::size_t count, std::size_t n) : f(func), participants(n), slots(new slot[n])
+    {
+      for (std::size_t p = 0; p < n; ++p) slots[p].range.store(pack(count * p / n, count * (p + 1) / n));
+    }
+
+    bool steal(std::size_t thief)
+    {
+      for (std::size_t k = 1; k < participants; ++k) {
+        auto& victim = slots[(thief + k) % participants].range;
+        std::uint64_t r = victim.load(std::memory_order_relaxed);
+        while (begin(r) < end(r)) {
+          const std::uint64_t mid = begin(r) + (end(r) - begin(r)) / 2;
+          if (victim.compare_exchange_weak(r, pack(begin(r), mid), std::memory_order_acq_rel)) {
+            slots[thief].range.store(pack(mid, end(r)), std::memory_order_release);
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    static void execute(void* context, std::size_t participant)
+    {
+      auto& l = *static_cast<stealing_loop*>(context);
+      auto& own = l.slots[participant].range;
+      do {
+        std::uint64_t r = own.load(std::memory_order_acquire);
+        while (begin(r) < end(r)) {
+          if (own.compare_exchange_weak(r, pack(begin(r) + 1, end(r)), std::memory_order_acq_rel)) {
+            l.f(static_cast<std::size_t>(begin(r)));
+            r = own.load(std::memory_order_acquire);
+          }
+        }
+      } while (l.steal(participant));
+    }
+  };
+
+  void run(std::size_t participant_count, job& j)
+  {
+    {
+      std::lock_guard lock(mutex_);
+      current_ = &j;
+      participants_ = participant_count;
+      ++generation_;
+    }
+    work_available_.notify_all();
+
+    j.execute(j.context, 0);
+
+    std::unique_lock lock(mutex_);
+    work_done_.wait(lock, [&] { return active_ == 0; });
+    current_ = nullptr;
+  }
+
+  void worker_loop(std::size_t participant)
+  {
+    std::uint64_t seen = 0;
+    for (;;) {
+      job* j = nullptr;
+      {
+        std::unique_lock lock(mutex_);
+        work_available_.wait(lock, [&] { return stop_ || generation_ != seen; });
+        if (stop_) return;
+        seen = generation_;
+        if (current_ == nullptr || participant >= participants_) continue;
+        j = current_;
+        ++active_;
+      }
+      j->execute(j->context, participant);
+      {
+        std::lock_guard lock(mutex_);
+        if (--active_ == 0) work_done_.notify_all();
+      }
+    }
+  }
+
+public:
+  /**
+   * @brief Creates a pool
+   *
+   * @param thread_count the total number of threads running a loop including the calling one
+   */
+  explicit thread_pool(std::size_t thread_count = std::max(1u, std::thread::hardware_concurrency()))
+  {
+    for (std::size_t i = 1; i < thread_count; ++i) workers_.emplace_back([this, i] { worker_loop(i); });
+  }
+
+  thread_pool(const thread_pool&) = delete;
+  thread_pool& operator=(const thread_pool&) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard lock(mutex_);
+      stop_ = true;
+    }
+    work_available_.notify_all();
+    for (auto& w : workers_) w.join();
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept { return workers_.size() + 1; }
+
+  /**
+   * @brief Calls `f(first, last)` for consecutive chunks of `[0, count)` and waits for all of them
+   *
+   * @param count the number of elements to process
+   * @param grain the maximum number of elements processed by a single call to `f`
+   * @param f the function invoked for every chunk
+   */
+  template<std::invocable<std::size_t, std::size_t> F>
+  void parallel_for(std::size_t count, std::size_t grain, F&& f)
+  {
+    grain = std::max<std::size_t>(grain, 1);
+    if (workers_.empty() || count <= grain) {
+      if (count > 0) f(std::size_t{0}, count);
+      return;
+    }
+
+    chunked_loop<std::remove_reference_t<F>> l{f, count, grain};
+    job j{&l, &decltype(l)::execute};
+    run(size(), j);
+  }
+
+  /**
+   * @brief Calls `f(i)` for every `i` in `[0, count)` and waits for all of them
+   *
+   * Every thread starts with an equal share of the indices and, when done, steals half of the
+   * remaining indices of another thread. This balances the load when the cost of the elements
+   * differs a lot and is not known upfront.
+   *
+   * @param count the number of elements to process; it must fit in 32 bits
+   * @param f the function invoked for every element
+   */
+  template<std::invocable<std::size_t> F>
+  void parallel_for_each(std::size_t count, F&& f)
+  {
+    gsl_Expects(count <= 0xFFFF'FFFF);
+    const std::size_t participants = std::min(size(), count);
+    if (participants <= 1) {
+      for (std::size_t i = 0; i < count; ++i) f(i);
+      return;
+    }
+
+    stealing_loop<std::remove_reference_t<F>> l(f, count, participants);
+    job j{&l, &decltype(l)::execute};
+    run(participants, j);
+  }
+};
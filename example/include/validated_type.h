@@ -26,17 +26,40 @@
 #include <mp-units/bits/external/hacks.h>
 #include <mp-units/bits/fmt.h>
 #include <mp-units/customization_points.h>
+#include <concepts>
 #include <ostream>
+#include <type_traits>
 #include <utility>
 
+// the value is known to be valid and is not checked
 inline constexpr struct validated_tag {
 } validated;
 
-template<std::movable T, std::predicate<T> Validator>
+// validation policies of the results of the operations that are proven to stay in range (e.g. the negation
+// of a value from a symmetric range); the values constructed without a tag are checked regardless of the policy
+
+// the proven results are checked as well
+struct check_always {
+  static constexpr bool check_proven_results = true;
+};
+
+// only the values which range cannot be proven are checked (e.g. the input data and the results of arbitrary
+// arithmetic on the underlying type)
+struct check_unproven {
+  static constexpr bool check_proven_results = false;
+};
+
+template<typename P>
+concept ValidationPolicy = requires {
+  { P::check_proven_results } -> std::convertible_to<bool>;
+};
+
+template<std::movable T, std::predicate<T> Validator, ValidationPolicy Policy = check_always>
 class validated_type {
   T value_;
 public:
   using value_type = T;
+  using policy = Policy;
 
   static constexpr bool validate(const T& value) { return Validator()(value); }
 
@@ -101,27 +124,27 @@ public:
   = default;
 };
 
-template<typename T, typename Validator>
-inline constexpr bool mp_units::is_scalar<validated_type<T, Validator>> = mp_units::is_scalar<T>;
+template<typename T, typename Validator, typename Policy>
+inline constexpr bool mp_units::is_scalar<validated_type<T, Validator, Policy>> = mp_units::is_scalar<T>;
 
-template<typename T, typename Validator>
-inline constexpr bool mp_units::treat_as_floating_point<validated_type<T, Validator>> =
+template<typename T, typename Validator, typename Policy>
+inline constexpr bool mp_units::treat_as_floating_point<validated_type<T, Validator, Policy>> =
   mp_units::treat_as_floating_point<T>;
 
 
-template<typename CharT, typename Traits, typename T, typename Validator>
+template<typename CharT, typename Traits, typename T, typename Validator, typename Policy>
 std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os,
-                                              const validated_type<T, Validator>& v)
+                                              const validated_type<T, Validator, Policy>& v)
   requires requires { os << v.value(); }
 {
   return os << v.value();
 }
 
 
-template<typename T, typename Validator>
-struct MP_UNITS_STD_FMT::formatter<validated_type<T, Validator>> : formatter<T> {
+template<typename T, typename Validator, typename Policy>
+struct MP_UNITS_STD_FMT::formatter<validated_type<T, Validator, Policy>> : formatter<T> {
   template<typename FormatContext>
-  auto format(const validated_type<T, Validator>& v, FormatContext& ctx)
+  auto format(const validated_type<T, Validator, Policy>& v, FormatContext& ctx)
   {
     return formatter<T>::format(v.value(), ctx);
   }
@@ -0,0 +1,313 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "kalman.h"
+#include "thread_pool.h"
+#include <gsl/gsl-lite.hpp>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace mp_units::kalman {
+
+template<typename R, typename QQP>
+concept Measurements =
+  std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+  QuantityOrQuantityPoint<std::ranges::range_value_t<R>> &&
+  (std::ranges::range_value_t<R>::quantity_spec == QQP::quantity_spec);
+
+/**
+ * @brief Many independent Kalman filters sharing the same state layout
+ *
+ * Tracks are stored as structure-of-arrays columns of raw numerical values: one column per state variable
+ * and one per covariance element, each expressed in the same unit as in `state` and `covariance`. Units are
+ * resolved once per call at the typed boundary so that the kernels reduce to plain multiply-add loops over
+ * contiguous columns that the compiler can vectorize. All the tracks are predicted with the same interval
+ * and process noise, and updated with a measurement of the first state variable.
+ */
+template<QuantityOrQuantityPoint... QQPs>
+  requires(sizeof...(QQPs) > 0) && are_time_derivatives<QQPs::dimension...>
+class filter_bank {
+public:
+  using estimation_type = estimation<QQPs...>;
+  using covariance_type = covariance<QQPs...>;
+  using rep = typename covariance_type::rep;
+  static constexpr std::size_t state_size = sizeof...(QQPs);
+
+  // the number of tracks processed together by a kernel; the scratch columns of a block stay in L1
+  static constexpr std::size_t block_size = 256;
+
+  // the number of tracks handed to a thread pool worker at once
+  static constexpr std::size_t grain_size = 16 * block_size;
+
+private:
+  static constexpr std::size_t n = state_size;
+
+  template<std::size_t I>
+  using variable_type = std::tuple_element_t<I, std::tuple<QQPs...>>;
+
+  std::array<std::vector<rep>, n> state_;
+  std::array<std::vector<rep>, n * n> covariance_;
+
+  template<std::size_t I, typename QQP>
+  [[nodiscard]] static constexpr rep to_raw(const QQP& v)
+  {
+    using type = variable_type<I>;
+    if constexpr (mp_units::QuantityPoint<QQP>)
+      return to_raw<I>(v - type::point_origin);
+    else
+      return mp_units::value_cast<rep>(v).numerical_value_in(type::unit);
+  }
+
+  template<std::size_t I>
+  [[nodiscard]] static constexpr variable_type<I> from_raw(rep v)
+  {
+    using type = variable_type<I>;
+    if constexpr (mp_units::QuantityPoint<type>)
+      return type::point_origin + static_cast<typename type::rep>(v) * type::reference;
+    else
+      return static_cast<typename type::rep>(v) * type::reference;
+  }
+
+  // row-major state transition matrix of the time derivatives chain expressed in the units of the columns
+  template<mp_units::QuantityOf<mp_units::isq::time> T>
+  [[nodiscard]] static std::array<rep, n * n> transition(T interval)
+  {
+    std::array<rep, n * n> f{};
+    [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+      (
+        [&]<std::size_t I, std::size_t K>() {
+          if constexpr (I == K)
+            f[I * n + K] = 1;
+          else if constexpr (I < K)
+            f[I * n + K] = to_raw<I>(rep{1} * variable_type<K>::reference * detail::pow_over_factorial<K - I>(interval));
+        }.template operator()<Ks / n, Ks % n>(),
+        ...);
+    }(std::make_index_sequence<n * n>{});
+    return f;
+  }
+
+  void predict_kernel(std::size_t first, std::size_t last, const std::array<rep, n * n>& f,
+                      const std::array<rep, n * n>& process_noise)
+  {
+    std::array<rep, n * n * block_size> fp;
+    for (std::size_t b = first; b < last; b += block_size) {
+      const std::size_t len = std::min(block_size, last - b);
+
+      // x_I += f_IK * x_K; going top-down reads only the not yet extrapolated variables
+      for (std::size_t i = 0; i < n; ++i) {
+        rep* const xi = state_[i].data() + b;
+        for (std::size_t k = i + 1; k < n; ++k) {
+          const rep* const xk = state_[k].data() + b;
+          const rep c = f[i * n + k];
+          for (std::size_t t = 0; t < len; ++t) xi[t] += c * xk[t];
+        }
+      }
+
+      // F * P
+      for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t l = 0; l < n; ++l) {
+          rep* const out = fp.data() + (i * n + l) * block_size;
+          const rep* const p = covariance_[i * n + l].data() + b;
+          for (std::size_t t = 0; t < len; ++t) out[t] = p[t];
+          for (std::size_t k = i + 1; k < n; ++k) {
+            const rep* const pk = covariance_[k * n + l].data() + b;
+            const rep c = f[i * n + k];
+            for (std::size_t t = 0; t < len; ++t) out[t] += c * pk[t];
+          }
+        }
+
+      // (F * P) * F^T + Q
+      for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j) {
+          rep* const out = covariance_[i * n + j].data() + b;
+          const rep* const a = fp.data() + (i * n + j) * block_size;
+          const rep q = process_noise[i * n + j];
+          for (std::size_t t = 0; t < len; ++t) out[t] = a[t] + q;
+          for (std::size_t l = j + 1; l < n; ++l) {
+            const rep* const al = fp.data() + (i * n + l) * block_size;
+            const rep c = f[j * n + l];
+            for (std::size_t t = 0; t < len; ++t) out[t] += c * al[t];
+          }
+        }
+    }
+  }
+
+  template<typename QM>
+  void update_kernel(std::size_t first, std::size_t last, std::span<const QM> measurements, rep measurement_uncertainty)
+  {
+    std::array<rep, block_size> innovation;
+    std::array<rep, block_size> inv_innovation_uncertainty;
+    std::array<rep, block_size> gain;
+    std::array<rep, n * block_size> row0;
+    for (std::size_t b = first; b < last; b += block_size) {
+      const std::size_t len = std::min(block_size, last - b);
+
+      const rep* const x0 = state_[0].data() + b;
+      const rep* const p00 = covariance_[0].data() + b;
+      for (std::size_t t = 0; t < len; ++t) {
+        innovation[t] = to_raw<0>(measurements[b + t]) - x0[t];
+        inv_innovation_uncertainty[t] = rep{1} / (p00[t] + measurement_uncertainty);
+      }
+      for (std::size_t j = 0; j < n; ++j) std::copy_n(covariance_[j].data() + b, len, row0.data() + j * block_size);
+
+      // K_I = P_I0 / S; x_I += K_I * y; P_IJ -= K_I * P_0J
+      for (std::size_t i = 0; i < n; ++i) {
+        const rep* const pi0 = covariance_[i * n].data() + b;
+        for (std::size_t t = 0; t < len; ++t) gain[t] = pi0[t] * inv_innovation_uncertainty[t];
+
+        rep* const xi = state_[i].data() + b;
+        for (std::size_t t = 0; t < len; ++t) xi[t] += gain[t] * innovation[t];
+
+        for (std::size_t j = 0; j < n; ++j) {
+          rep* const pij = covariance_[i * n + j].data() + b;
+          const rep* const p0j = row0.data() + j * block_size;
+          for (std::size_t t = 0; t < len; ++t) pij[t] -= gain[t] * p0j[t];
+        }
+      }
+    }
+  }
+
+  template<typename F>
+  void for_each_chunk(thread_pool* pool, F&& f)
+  {
+    if (pool)
+      pool->parallel_for(size(), grain_size, f);
+    else
+      f(std::size_t{0}, size());
+  }
+
+  template<mp_units::QuantityOf<mp_units::isq::time> T>
+  void do_predict(thread_pool* pool, T interval, const covariance_type& process_noise)
+  {
+    const auto f = transition(interval);
+    for_each_chunk(pool, [&](std::size_t first, std::size_t last) {
+      predict_kernel(first, last, f, process_noise.values_);
+    });
+  }
+
+  template<QuantityOrQuantityPoint QM, mp_units::Quantity R>
+  void do_update(thread_pool* pool, std::span<const QM> measurements, R measurement_uncertainty)
+  {
+    gsl_Expects(measurements.size() == size());
+    using element_type = typename covariance_type::template element_type<0, 0>;
+    const rep r = element_type(measurement_uncertainty).numerical_value_in(element_type::unit);
+    for_each_chunk(pool, [&](std::size_t first, std::size_t last) { update_kernel(first, last, measurements, r); });
+  }
+
+public:
+  [[nodiscard]] std::size_t size() const noexcept { return state_[0].size(); }
+  [[nodiscard]] bool empty() const noexcept { return state_[0].empty(); }
+
+  void reserve(std::size_t count)
+  {
+    for (auto& c : state_) c.reserve(count);
+    for (auto& c : covariance_) c.reserve(count);
+  }
+
+  void clear() noexcept
+  {
+    for (auto& c : state_) c.clear();
+    for (auto& c : covariance_) c.clear();
+  }
+
+  // appends a new track and returns its index
+  std::size_t push_back(const estimation_type& e)
+  {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (state_[Is].push_back(to_raw<Is>(get<Is>(e.state))), ...);
+    }(std::make_index_sequence<n>{});
+    if constexpr (n == 1) {
+      using element_type = typename covariance_type::template element_type<0, 0>;
+      covariance_[0].push_back(element_type(e.uncertainty).numerical_value_in(element_type::unit));
+    } else {
+      for (std::size_t k = 0; k < n * n; ++k) covariance_[k].push_back(e.uncertainty.values_[k]);
+    }
+    return size() - 1;
+  }
+
+  // gathers the current estimation of a track
+  [[nodiscard]] estimation_type operator[](std::size_t index) const
+  {
+    gsl_Expects(index < size());
+    const auto s = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return state<QQPs...>{from_raw<Is>(state_[Is][index])...};
+    }(std::make_index_sequence<n>{});
+    if constexpr (n == 1) {
+      return {s, covariance_[0][index] * covariance_type::template element_type<0, 0>::reference};
+    } else {
+      covariance_type c;
+      for (std::size_t k = 0; k < n * n; ++k) c.values_[k] = covariance_[k][index];
+      return {s, c};
+    }
+  }
+
+  /**
+   * @brief Extrapolates the state and the covariance of all the tracks
+   *
+   * Performs `state_extrapolation` and `covariance_extrapolation` for every track.
+   */
+  template<mp_units::QuantityOf<mp_units::isq::time> T>
+  void predict(T interval, const covariance_type& process_noise)
+  {
+    do_predict(nullptr, interval, process_noise);
+  }
+
+  template<mp_units::QuantityOf<mp_units::isq::time> T>
+  void predict(thread_pool& pool, T interval, const covariance_type& process_noise)
+  {
+    do_predict(&pool, interval, process_noise);
+  }
+
+  /**
+   * @brief Corrects all the tracks with measurements of the first state variable
+   *
+   * Computes the Kalman gains and performs `state_update` and `covariance_update` for every track.
+   *
+   * @param measurements one measurement per track in the order of track indices
+   * @param measurement_uncertainty the variance of every measurement
+   */
+  template<Measurements<variable_type<0>> M, mp_units::Quantity R>
+  void update(const M& measurements, R measurement_uncertainty)
+  {
+    do_update(nullptr, std::span(std::ranges::data(measurements), std::ranges::size(measurements)),
+              measurement_uncertainty);
+  }
+
+  template<Measurements<variable_type<0>> M, mp_units::Quantity R>
+  void update(thread_pool& pool, const M& measurements, R measurement_uncertainty)
+  {
+    do_update(&pool, std::span(std::ranges::data(measurements), std::ranges::size(measurements)),
+              measurement_uncertainty);
+  }
+};
+
+}  // namespace mp_units::kalman
@@ -0,0 +1,109 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kalman.h"
+#include "kalman_bank.h"
+#include "thread_pool.h"
+#include <mp-units/clock.h>
+#include <mp-units/format.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Tracks many aircraft at once with a bank of multivariate Kalman filters and checks the results
+// against the filter running on a single `estimation`
+
+template<class T>
+  requires mp_units::is_scalar<T>
+inline constexpr bool mp_units::is_vector<T> = true;
+
+using namespace mp_units;
+
+int main()
+{
+  using namespace kalman;
+  using namespace mp_units::si::unit_symbols;
+  using position = quantity<isq::position_vector[m]>;
+  using velocity = quantity<isq::velocity[m / s]>;
+  using acceleration = quantity<isq::acceleration[m / s2]>;
+
+  constexpr std::size_t track_count = 50'000;
+  constexpr int frame_count = 10;
+
+  const auto interval = isq::duration(5. * s);
+  const covariance<position, velocity, acceleration> process_noise{
+    pow<2>(1. * isq::position_vector[m]), pow<2>(0.5 * isq::velocity[m / s]), pow<2>(0.2 * isq::acceleration[m / s2])};
+  const auto measurement_uncertainty = pow<2>(50. * isq::position_vector[m]);
+
+  std::mt19937 gen(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  std::uniform_real_distribution<double> start_position(10'000., 50'000.);
+  std::uniform_real_distribution<double> start_velocity(40., 250.);
+  std::normal_distribution<double> noise(0., 50.);
+
+  filter_bank<position, velocity, acceleration> bank;
+  bank.reserve(track_count);
+  std::vector<position> truth;
+  std::vector<velocity> speed;
+  for (std::size_t i = 0; i < track_count; ++i) {
+    truth.push_back(start_position(gen) * isq::position_vector[m]);
+    speed.push_back(start_velocity(gen) * isq::velocity[m / s]);
+    bank.push_back(estimation{state<position, velocity, acceleration>{truth.back(), 0. * m / s, 0. * m / s2},
+                              covariance<position, velocity, acceleration>{pow<2>(500. * isq::position_vector[m]),
+                                                                           pow<2>(100. * isq::velocity[m / s]),
+                                                                           pow<2>(10. * isq::acceleration[m / s2])}});
+  }
+
+  // a reference filter following the first track
+  estimation single = bank[0];
+
+  thread_pool pool;
+  std::vector<position> measurements(track_count);
+  quantity_clock<>::duration elapsed{};
+  for (int frame = 1; frame <= frame_count; ++frame) {
+    for (std::size_t i = 0; i < track_count; ++i) {
+      truth[i] += speed[i] * interval;
+      measurements[i] = truth[i] + noise(gen) * isq::position_vector[m];
+    }
+
+    const auto start = quantity_clock<>::now();
+    bank.predict(pool, interval, process_noise);
+    bank.update(pool, measurements, measurement_uncertainty);
+    elapsed += quantity_clock<>::now() - start;
+
+    single = update(predict(single, interval, process_noise), measurements[0], measurement_uncertainty);
+  }
+
+  const estimation first = bank[0];
+  std::cout << MP_UNITS_STD_FMT::format("Tracks: {}, frames: {}, threads: {}\n", track_count, frame_count,
+                                        pool.size());
+  std::cout << MP_UNITS_STD_FMT::format("Time per frame: {:%.3Q %q}\n",
+                                        value_cast<double>(elapsed / frame_count).in(si::milli<si::second>));
+  std::cout << MP_UNITS_STD_FMT::format("Truth:  {:%.1Q %q}, {:%.1Q %q}\n", truth[0], speed[0]);
+  std::cout << MP_UNITS_STD_FMT::format("Bank:   {:.1}\n", first.state);
+  std::cout << MP_UNITS_STD_FMT::format("Single: {:.1}\n", single.state);
+  std::cout << MP_UNITS_STD_FMT::format("Position std dev: {:%.1Q %q} (bank), {:%.1Q %q} (single)\n",
+                                        sqrt(get<0, 0>(first.uncertainty)), sqrt(get<0, 0>(single.uncertainty)));
+}
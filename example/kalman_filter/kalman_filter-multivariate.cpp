@@ -0,0 +1,82 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "kalman.h"
+#include <mp-units/format.h>
+#include <mp-units/math.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <iostream>
+
+// Tracks the accelerating aircraft from https://www.kalmanfilter.net/alphabeta.html#ex4 with a multivariate
+// Kalman filter which computes the gains from the state covariance rather than using fixed ones
+
+template<class T>
+  requires mp_units::is_scalar<T>
+inline constexpr bool mp_units::is_vector<T> = true;
+
+using namespace mp_units;
+
+void print_header(const kalman::State auto& initial)
+{
+  std::cout << MP_UNITS_STD_FMT::format("Initial: {}\n", initial);
+  std::cout << MP_UNITS_STD_FMT::format("{:>2} | {:>8} | {:>35} | {:>12}\n", "N", "Measured", "Curr. Estimate",
+                                        "Pos. Std Dev");
+}
+
+template<kalman::Covariance C>
+void print(auto iteration, Quantity auto measured, const kalman::State auto& current, const C& uncertainty)
+{
+  std::cout << MP_UNITS_STD_FMT::format("{:2} | {:8} | {:>35.1} | {:12%.1Q %q}\n", iteration, measured, current,
+                                        sqrt(kalman::get<0, 0>(uncertainty)));
+}
+
+int main()
+{
+  using namespace kalman;
+  using namespace mp_units::si::unit_symbols;
+  using position = quantity<isq::position_vector[m]>;
+  using velocity = quantity<isq::velocity[m / s]>;
+  using acceleration = quantity<isq::acceleration[m / s2]>;
+
+  const auto interval = isq::duration(5. * s);
+  const estimation initial = {
+    state<position, velocity, acceleration>{30 * km, 50 * m / s, 0 * m / s2},
+    covariance<position, velocity, acceleration>{pow<2>(500. * isq::position_vector[m]),
+                                                 pow<2>(100. * isq::velocity[m / s]),
+                                                 pow<2>(10. * isq::acceleration[m / s2])}};
+  const covariance<position, velocity, acceleration> process_noise{
+    pow<2>(1. * isq::position_vector[m]), pow<2>(0.5 * isq::velocity[m / s]), pow<2>(0.2 * isq::acceleration[m / s2])};
+  const auto measurement_uncertainty = pow<2>(50. * isq::position_vector[m]);
+
+  const quantity<isq::position_vector[m], int> measurements[] = {30'160 * m, 30'365 * m, 30'890 * m, 31'050 * m,
+                                                                 31'785 * m, 32'215 * m, 33'130 * m, 34'510 * m,
+                                                                 36'010 * m, 37'265 * m};
+
+  print_header(initial.state);
+  estimation next = predict(initial, interval, process_noise);
+  for (int index = 1; const auto& measured : measurements) {
+    const estimation current = update(next, measured, measurement_uncertainty);
+    print(index++, measured, current.state, current.uncertainty);
+    next = predict(current, interval, process_noise);
+  }
+}
@@ -20,112 +20,15 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <mp-units/measurement.h>
 #include <mp-units/ostream.h>
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si/unit_symbols.h>
 #include <mp-units/systems/si/units.h>
-#include <cmath>
 #include <exception>
 #include <iostream>
 
-namespace {
-
-template<typename T>
-class measurement {
-public:
-  using value_type = T;
-
-  measurement() = default;
-
-  constexpr explicit measurement(value_type val, const value_type& err = {}) : value_(std::move(val))
-  {
-    // it sucks that using declaration cannot be provided for a constructor initializer list
-    using namespace std;
-    uncertainty_ = abs(err);
-  }
-
-  [[nodiscard]] constexpr const value_type& value() const { return value_; }
-  [[nodiscard]] constexpr const value_type& uncertainty() const { return uncertainty_; }
-
-  [[nodiscard]] constexpr value_type relative_uncertainty() const { return uncertainty() / value(); }
-  [[nodiscard]] constexpr value_type lower_bound() const { return value() - uncertainty(); }
-  [[nodiscard]] constexpr value_type upper_bound() const { return value() + uncertainty(); }
-
-  [[nodiscard]] constexpr measurement operator-() const { return measurement(-value(), uncertainty()); }
-
-  [[nodiscard]] friend constexpr measurement operator+(const measurement& lhs, const measurement& rhs)
-  {
-    using namespace std;
-    return measurement(lhs.value() + rhs.value(), hypot(lhs.uncertainty(), rhs.uncertainty()));
-  }
-
-  [[nodiscard]] friend constexpr measurement operator-(const measurement& lhs, const measurement& rhs)
-  {
-    using namespace std;
-    return measurement(lhs.value() - rhs.value(), hypot(lhs.uncertainty(), rhs.uncertainty()));
-  }
-
-  [[nodiscard]] friend constexpr measurement operator*(const measurement& lhs, const measurement& rhs)
-  {
-    const auto val = lhs.value() * rhs.value();
-    using namespace std;
-    return measurement(val, val * hypot(lhs.relative_uncertainty(), rhs.relative_uncertainty()));
-  }
-
-  [[nodiscard]] friend constexpr measurement operator*(const measurement& lhs, const value_type& value)
-  {
-    const auto val = lhs.value() * value;
-    return measurement(val, val * lhs.relative_uncertainty());
-  }
-
-  [[nodiscard]] friend constexpr measurement operator*(const value_type& value, const measurement& rhs)
-  {
-    const auto val = rhs.value() * value;
-    return measurement(val, val * rhs.relative_uncertainty());
-  }
-
-  [[nodiscard]] friend constexpr measurement operator/(const measurement& lhs, const measurement& rhs)
-  {
-    const auto val = lhs.value() / rhs.value();
-    using namespace std;
-    return measurement(val, val * hypot(lhs.relative_uncertainty(), rhs.relative_uncertainty()));
-  }
-
-  [[nodiscard]] friend constexpr measurement operator/(const measurement& lhs, const value_type& value)
-  {
-    const auto val = lhs.value() / value;
-    return measurement(val, val * lhs.relative_uncertainty());
-  }
-
-  [[nodiscard]] friend constexpr measurement operator/(const value_type& value, const measurement& rhs)
-  {
-    const auto val = value / rhs.value();
-    return measurement(val, val * rhs.relative_uncertainty());
-  }
-
-  [[nodiscard]] constexpr auto operator<=>(const measurement&) const = default;
-
-  friend std::ostream& operator<<(std::ostream& os, const measurement& v)
-  {
-    return os << v.value() << " ± " << v.uncertainty();
-  }
-
-private:
-  value_type value_{};
-  value_type uncertainty_{};
-};
-
-}  // namespace
-
-template<class T>
-inline constexpr bool mp_units::treat_as_floating_point<measurement<T>> = mp_units::treat_as_floating_point<T>;
-
-template<class T>
-inline constexpr bool mp_units::is_scalar<measurement<T>> = true;
-template<class T>
-inline constexpr bool mp_units::is_vector<measurement<T>> = true;
-
-static_assert(mp_units::RepresentationOf<measurement<double>, mp_units::quantity_character::scalar>);
+static_assert(mp_units::RepresentationOf<mp_units::measurement<double>, mp_units::quantity_character::scalar>);
 
 namespace {
 
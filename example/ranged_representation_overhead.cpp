@@ -0,0 +1,95 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "geographic.h"
+#include "ranged_representation.h"
+#include <mp-units/clock.h>
+#include <mp-units/format.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/si/si.h>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Measures the cost of validating the representation of every intermediate result in bulk
+// geographic computations, and how much of it is saved by validating only the input data
+
+namespace {
+
+using namespace mp_units;
+
+template<typename Policy>
+using latitude = quantity_point<si::degree, geographic::equator, ranged_representation<double, -90, 90, Policy>>;
+
+// midpoints of the latitudes of consecutive points reflected to the other hemisphere
+template<typename Policy>
+void reflected_midpoints(const std::vector<latitude<Policy>>& in, std::vector<latitude<Policy>>& out)
+{
+  for (std::size_t i = 0; i + 1 < in.size(); ++i) {
+    // both the midpoint and the negation are proven to stay in range
+    const auto mid = midpoint(in[i].quantity_from(geographic::equator).numerical_value_in(si::degree),
+                              in[i + 1].quantity_from(geographic::equator).numerical_value_in(si::degree));
+    out[i] = geographic::equator + (-mid) * si::degree;
+  }
+}
+
+template<typename Policy>
+quantity_clock<>::duration measure(const std::vector<double>& data, int repetitions)
+{
+  using rep = ranged_representation<double, -90, 90, Policy>;
+
+  // the input boundary is always checked
+  std::vector<latitude<Policy>> in;
+  in.reserve(data.size());
+  for (double v : data) in.push_back(geographic::equator + rep(v) * si::degree);
+  std::vector<latitude<Policy>> out(in.size());
+
+  const auto start = quantity_clock<>::now();
+  for (int r = 0; r < repetitions; ++r) {
+    reflected_midpoints(in, out);
+    in.swap(out);
+  }
+  return quantity_clock<>::now() - start;
+}
+
+}  // namespace
+
+int main()
+{
+  constexpr std::size_t count = 1'000'000;
+  constexpr int repetitions = 20;
+
+  std::mt19937 gen(42);  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+  std::uniform_real_distribution<double> dist(-90., 90.);
+  std::vector<double> data(count);
+  for (auto& v : data) v = dist(gen);
+
+  const auto per_element = [](quantity_clock<>::duration d) {
+    return value_cast<double>(d).in(si::nano<si::second>) / static_cast<double>(count * repetitions);
+  };
+  const quantity checked_time = per_element(measure<check_always>(data, repetitions));
+  const quantity unchecked_time = per_element(measure<check_unproven>(data, repetitions));
+
+  std::cout << MP_UNITS_STD_FMT::format("Validating every result: {:%.3Q %q} per element\n", checked_time);
+  std::cout << MP_UNITS_STD_FMT::format("Validating the unproven values only: {:%.3Q %q} per element\n", unchecked_time);
+}
@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <mp-units/constant_quantity.h>
 #include <mp-units/format.h>
 #include <mp-units/systems/isq/isq.h>
 #include <mp-units/systems/si/si.h>
@@ -40,10 +41,10 @@ using mp_units::si::unit_symbols::mol;
 using mp_units::si::unit_symbols::THz;
 using mp_units::si::unit_symbols::um;
 
-// physical constants
-constexpr auto c = 1 * si::si2019::speed_of_light_in_vacuum;
-constexpr auto h = 1 * si::si2019::planck_constant;
-constexpr auto kb = 1 * si::si2019::boltzmann_constant;
+// physical constants (folded at compile time into the units of the results)
+constexpr constant_quantity<1, si::si2019::speed_of_light_in_vacuum> c;
+constexpr constant_quantity<1, si::si2019::planck_constant> h;
+constexpr constant_quantity<1, si::si2019::boltzmann_constant> kb;
 
 // prints quantities in the resulting unit
 template<QuantityOf<isq::energy> T1, QuantityOf<isq::wavenumber> T2, QuantityOf<isq::frequency> T3,
@@ -20,6 +20,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+#include <mp-units/constant_quantity.h>
 #include <mp-units/math.h>
 #include <mp-units/ostream.h>
 #include <mp-units/systems/isq/mechanics.h>
@@ -47,14 +48,14 @@ void si_example()
 {
   using namespace mp_units::si::unit_symbols;
   constexpr auto GeV = si::giga<si::electronvolt>;
-  constexpr QuantityOf<isq::speed> auto c = 1. * si::si2019::speed_of_light_in_vacuum;
-  auto c2 = pow<2>(c);
+  constexpr constant_quantity<1, si::si2019::speed_of_light_in_vacuum> c;
+  constexpr QuantityOf<isq::speed> auto c1 = 1. * c;
 
   const auto p1 = isq::momentum(4. * GeV / c);
-  const QuantityOf<isq::mass> auto m1 = 3. * GeV / c2;
-  const auto E = total_energy(p1, m1, c);
+  const QuantityOf<isq::mass> auto m1 = 3. * GeV / pow<2>(c);
+  const auto E = total_energy(p1, m1, c1);
 
-  std::cout << "\n*** SI units (c = " << c << " = " << c.in(si::metre / s) << ") ***\n";
+  std::cout << "\n*** SI units (c = " << c1 << " = " << c1.in(si::metre / s) << ") ***\n";
 
   std::cout << "\n[in `GeV` and `c`]\n"
             << "p = " << p1 << "\n"
@@ -63,7 +64,7 @@ void si_example()
 
   const auto p2 = p1.in(GeV / (m / s));
   const auto m2 = m1.in(GeV / pow<2>(m / s));
-  const auto E2 = total_energy(p2, m2, c).in(GeV);
+  const auto E2 = total_energy(p2, m2, c1).in(GeV);
 
   std::cout << "\n[in `GeV`]\n"
             << "p = " << p2 << "\n"
@@ -72,7 +73,7 @@ void si_example()
 
   const auto p3 = p1.in(kg * m / s);
   const auto m3 = m1.in(kg);
-  const auto E3 = total_energy(p3, m3, c).in(J);
+  const auto E3 = total_energy(p3, m3, c1).in(J);
 
   std::cout << "\n[in SI base units]\n"
             << "p = " << p3 << "\n"
@@ -191,6 +191,15 @@ template<typename CharT, typename Rep, typename OutputIt, typename Locale>
   return MP_UNITS_STD_FMT::vformat_to(out, buffer, MP_UNITS_STD_FMT::make_format_args(val));
 }
 
+// storage-only floating-point types are not supported by all the formatting libraries
+template<typename CharT, NarrowFloatingPoint Rep, typename OutputIt, typename Locale>
+[[nodiscard]] OutputIt format_units_quantity_value(OutputIt out, const Rep& val,
+                                                   const quantity_rep_format_specs& rep_specs, const Locale& loc)
+{
+  const auto promoted = static_cast<float>(val);
+  return format_units_quantity_value<CharT>(out, promoted, rep_specs, loc);
+}
+
 // Creates a global format string
 //  e.g. "{:*^10%.1Q_%q}, 1.23_q_m" => "{:*^10}"
 template<typename CharT, typename OutputIt>
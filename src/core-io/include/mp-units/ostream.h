@@ -37,6 +37,9 @@ void to_stream(std::basic_ostream<CharT, Traits>& os, const quantity<R, Rep>& q)
   if constexpr (is_same_v<Rep, std::uint8_t> || is_same_v<Rep, std::int8_t>)
     // promote the value to int
     os << +q.numerical_value_ref_in(q.unit);
+  else if constexpr (NarrowFloatingPoint<Rep>)
+    // storage-only floating-point types may not provide a stream insertion operator
+    os << static_cast<float>(q.numerical_value_ref_in(q.unit));
   else
     os << q.numerical_value_ref_in(q.unit);
   if constexpr (has_unit_symbol(get_unit(R))) {
@@ -0,0 +1,202 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/ratio.h>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace mp_units::detail {
+
+/**
+ * @brief An unevaluated sum of two `double` values providing about 106 bits of precision
+ *
+ * Used to evaluate the magnitudes at compile time precisely enough to round the result only once to the target
+ * floating-point type.  The algorithms do not use `std::fma` as it is not `constexpr`.
+ */
+struct double_double {
+  double hi;
+  double lo = 0.;
+
+  [[nodiscard]] friend consteval double_double operator-(double_double v) { return {-v.hi, -v.lo}; }
+
+  [[nodiscard]] friend consteval double_double operator+(double_double lhs, double_double rhs)
+  {
+    const auto [s, e] = two_sum(lhs.hi, rhs.hi);
+    return quick_two_sum(s, e + lhs.lo + rhs.lo);
+  }
+
+  [[nodiscard]] friend consteval double_double operator-(double_double lhs, double_double rhs) { return lhs + -rhs; }
+
+  [[nodiscard]] friend consteval double_double operator*(double_double lhs, double_double rhs)
+  {
+    const auto [p, e] = two_prod(lhs.hi, rhs.hi);
+    return quick_two_sum(p, e + lhs.hi * rhs.lo + lhs.lo * rhs.hi);
+  }
+
+  [[nodiscard]] friend consteval double_double operator/(double_double lhs, double_double rhs)
+  {
+    // long division with three partial quotients
+    const double q1 = lhs.hi / rhs.hi;
+    const double_double r1 = lhs - rhs * double_double{q1};
+    const double q2 = r1.hi / rhs.hi;
+    const double_double r2 = r1 - rhs * double_double{q2};
+    const double q3 = r2.hi / rhs.hi;
+    return quick_two_sum(q1, q2) + double_double{q3};
+  }
+
+  // raises the value to a rational power
+  [[nodiscard]] friend consteval double_double pow(double_double base, ratio exp)
+  {
+    if (exp.num < 0) return double_double{1.} / pow(base, -exp);
+    return int_power(exp.den == 1 ? base : root(base, exp.den), exp.num);
+  }
+
+  // the value rounded once to `T`
+  template<std::floating_point T>
+  [[nodiscard]] consteval T to() const
+  {
+    if constexpr (std::numeric_limits<T>::digits > std::numeric_limits<double>::digits)
+      return static_cast<T>(static_cast<T>(hi) + static_cast<T>(lo));
+    else {
+      // `hi` is already the value rounded to `double`; a narrower `T` may only be off when `hi` lies exactly
+      // halfway between two values of `T` and is rounded to the even one instead of towards `lo`
+      const T res = static_cast<T>(hi);
+      const double err = hi - static_cast<double>(res);
+      const double other = hi + err;
+      if (err != 0. && lo != 0. && (err > 0.) == (lo > 0.) && other - hi == err &&
+          static_cast<double>(static_cast<T>(other)) == other)
+        return static_cast<T>(other);
+      return res;
+    }
+  }
+
+private:
+  // raises the value to a non-negative integer power
+  [[nodiscard]] static consteval double_double int_power(double_double base, std::intmax_t exp)
+  {
+    double_double res{1.};
+    for (; exp > 0; exp /= 2) {
+      if (exp % 2 == 1) res = res * base;
+      base = base * base;
+    }
+    return res;
+  }
+
+  // the positive `n`-th root of a positive value computed with Newton's method
+  [[nodiscard]] static consteval double_double root(double_double v, std::intmax_t n)
+  {
+    // starting from above, the approximations in `double` decrease monotonically towards the root
+    double x = v.hi > 1. ? v.hi : 1.;
+    for (;;) {
+      double x_pow = 1.;
+      for (std::intmax_t i = 1; i < n; ++i) x_pow *= x;
+      const double next = (static_cast<double>(n - 1) * x + v.hi / x_pow) / static_cast<double>(n);
+      if (!(next < x)) break;
+      x = next;
+    }
+    // each iteration in `double_double` doubles the number of correct bits
+    double_double res{x};
+    for (int i = 0; i < 2; ++i) {
+      const double_double res_pow = int_power(res, n - 1);
+      res = res - (res_pow * res - v) / (double_double{static_cast<double>(n)} * res_pow);
+    }
+    return res;
+  }
+
+  // `a + b` and its rounding error
+  [[nodiscard]] static consteval double_double two_sum(double a, double b)
+  {
+    const double s = a + b;
+    const double v = s - a;
+    return {s, (a - (s - v)) + (b - v)};
+  }
+
+  // `a + b` and its rounding error for `|a| >= |b|`
+  [[nodiscard]] static consteval double_double quick_two_sum(double a, double b)
+  {
+    const double s = a + b;
+    return {s, b - (s - a)};
+  }
+
+  // Dekker's splitting of a value into two halves of 26 bits each
+  [[nodiscard]] static consteval double_double split(double a)
+  {
+    const double t = 134'217'729. * a;  // 2^27 + 1
+    const double hi = t - (t - a);
+    return {hi, a - hi};
+  }
+
+  // `a * b` and its rounding error
+  [[nodiscard]] static consteval double_double two_prod(double a, double b)
+  {
+    const double p = a * b;
+    const auto [ah, al] = split(a);
+    const auto [bh, bl] = split(b);
+    return {p, ((ah * bh - p) + ah * bl + al * bh) + al * bl};
+  }
+};
+
+[[nodiscard]] consteval double_double to_double_double(std::intmax_t v)
+{
+  const auto hi = static_cast<double>(v);
+  return {hi, static_cast<double>(static_cast<wide_int>(v) - static_cast<wide_int>(hi))};
+}
+
+[[nodiscard]] consteval double_double to_double_double(long double v)
+{
+  const auto hi = static_cast<double>(v);
+  return {hi, static_cast<double>(v - hi)};
+}
+
+inline constexpr double_double pi_double_double = {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53};
+
+/**
+ * @brief Multiplies a value by a factor provided as an unevaluated sum `hi + lo`
+ *
+ * The rounding error of `v * hi` is recovered with Dekker's exact product and added together with `v * lo`
+ * before the only rounding of the result.  This makes the product as precise as if it was done with the whole
+ * factor without the need for `std::fma` or a wider floating-point type.  The values that are too large
+ * to be split without an overflow are multiplied directly.
+ */
+template<std::floating_point T>
+[[nodiscard]] constexpr T compensated_product(T v, T hi, T lo)
+{
+  constexpr T splitter = static_cast<T>((std::uint64_t{1} << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+  constexpr T max_split = std::numeric_limits<T>::max() / splitter;
+  const T p = v * hi;
+  if (!(v < max_split && -v < max_split && hi < max_split && -hi < max_split)) return p + v * lo;
+  const auto split = [&](T a) {
+    const T t = splitter * a;
+    const T a_hi = t - (t - a);
+    return std::pair{a_hi, a - a_hi};
+  };
+  const auto [vh, vl] = split(v);
+  const auto [hh, hl] = split(hi);
+  const T e = ((vh * hh - p) + vh * hl + vl * hh) + vl * hl;
+  return p + (e + v * lo);
+}
+
+}  // namespace mp_units::detail
@@ -242,6 +242,26 @@ struct type_list_merge_sorted_impl<List<>, List<Rhs...>, Pred> {
   using type = List<Rhs...>;
 };
 
+// as both lists are sorted, when the 4th element of one list goes before the front of the other list, all four do;
+// moving them at once reduces the depth of the recursion
+template<template<typename...> typename List, typename Lhs1, typename Lhs2, typename Lhs3, typename Lhs4,
+         typename... LhsRest, typename Rhs1, typename... RhsRest, template<typename, typename> typename Pred>
+  requires Pred<Lhs4, Rhs1>::value
+struct type_list_merge_sorted_impl<List<Lhs1, Lhs2, Lhs3, Lhs4, LhsRest...>, List<Rhs1, RhsRest...>, Pred> {
+  using type = MP_UNITS_TYPENAME type_list_push_front_impl<
+    typename type_list_merge_sorted_impl<List<LhsRest...>, List<Rhs1, RhsRest...>, Pred>::type, Lhs1, Lhs2, Lhs3,
+    Lhs4>::type;
+};
+
+template<template<typename...> typename List, typename Lhs1, typename... LhsRest, typename Rhs1, typename Rhs2,
+         typename Rhs3, typename Rhs4, typename... RhsRest, template<typename, typename> typename Pred>
+  requires(!Pred<Lhs1, Rhs4>::value)
+struct type_list_merge_sorted_impl<List<Lhs1, LhsRest...>, List<Rhs1, Rhs2, Rhs3, Rhs4, RhsRest...>, Pred> {
+  using type = MP_UNITS_TYPENAME type_list_push_front_impl<
+    typename type_list_merge_sorted_impl<List<Lhs1, LhsRest...>, List<RhsRest...>, Pred>::type, Rhs1, Rhs2, Rhs3,
+    Rhs4>::type;
+};
+
 template<template<typename...> typename List, typename Lhs1, typename... LhsRest, typename Rhs1, typename... RhsRest,
          template<typename, typename> typename Pred>
   requires Pred<Lhs1, Rhs1>::value
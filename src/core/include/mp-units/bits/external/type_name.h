@@ -2,10 +2,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <string_view>
 
+// the return type has to be deduced for the prefixes below to match
 template<typename T>
-[[nodiscard]] consteval std::string_view type_name()
+[[nodiscard]] consteval auto type_name()
 {
   std::string_view name, prefix, suffix;
 #ifdef __clang__
@@ -26,14 +29,80 @@ template<typename T>
   return name;
 }
 
+// The name of `T` stripped of the class-key and of the enclosing namespaces and classes
+// (both are spelled differently by different compilers)
+template<typename T>
+[[nodiscard]] consteval std::string_view unqualified_type_name()
+{
+  std::string_view name = type_name<T>();
+  for (std::string_view key : {"struct ", "class ", "enum ", "union "})
+    if (name.starts_with(key)) name.remove_prefix(key.size());
+  if (const auto pos = name.rfind("::", name.find('<')); pos != std::string_view::npos) name.remove_prefix(pos + 2);
+  return name;
+}
+
+// Ordering key of a type computed once per type: the first 8 characters of its unqualified name packed
+// in a big-endian order, so comparing two keys gives the same result as comparing those prefixes
+template<typename T>
+inline constexpr std::uint64_t type_name_key = [] {
+  constexpr std::string_view name = unqualified_type_name<T>();
+  std::uint64_t key = 0;
+  for (std::size_t i = 0; i < sizeof(key); ++i)
+    key = (key << 8) | (i < name.size() ? static_cast<unsigned char>(name[i]) : 0U);
+  return key;
+}();
+
+// Length of the class-key starting a word at `pos` of a type name (0 if there is none)
+[[nodiscard]] constexpr std::size_t class_key_length(std::string_view name, std::size_t pos)
+{
+  if (pos != 0 && name[pos - 1] != ' ' && name[pos - 1] != '<' && name[pos - 1] != ',' && name[pos - 1] != '(')
+    return 0;
+  for (std::string_view key : {"struct ", "class ", "enum ", "union "})
+    if (name.substr(pos).starts_with(key)) return key.size();
+  return 0;
+}
+
+// FNV-1a hash of the unqualified name of a type that orders the types with equal `type_name_key`;
+// the class-keys and the whitespace are skipped as compilers spell them differently in template arguments
+template<typename T>
+inline constexpr std::uint64_t type_name_hash = [] {
+  constexpr std::string_view name = unqualified_type_name<T>();
+  std::uint64_t hash = 14'695'981'039'346'656'037ULL;
+  for (std::size_t i = 0; i < name.size();) {
+    if (const std::size_t length = class_key_length(name, i)) {
+      i += length;
+      continue;
+    }
+    if (name[i] != ' ') hash = (hash ^ static_cast<unsigned char>(name[i])) * 1'099'511'628'211ULL;
+    ++i;
+  }
+  return hash;
+}();
+
+// Order of types that compares the precomputed integers; the full names are compared only for the types
+// in different scopes sharing the unqualified name or on a hash collision, which keeps the order total
+template<typename T1, typename T2>
+[[nodiscard]] consteval bool type_name_less_impl()
+{
+  if constexpr (type_name_key<T1> != type_name_key<T2>)
+    return type_name_key<T1> < type_name_key<T2>;
+  else if constexpr (type_name_hash<T1> != type_name_hash<T2>)
+    return type_name_hash<T1> < type_name_hash<T2>;
+  else
+    return type_name<T1>() < type_name<T2>();
+}
+
+template<typename T1, typename T2>
+inline constexpr bool type_name_less = type_name_less_impl<T1, T2>();
+
 template<typename T1, typename T2>
 [[nodiscard]] consteval auto better_type_name(T1 v1, T2 v2)
 {
-  if constexpr (type_name<T1>().size() < type_name<T2>().size())
+  if constexpr (unqualified_type_name<T1>().size() < unqualified_type_name<T2>().size())
     return v1;
-  else if constexpr (type_name<T2>().size() < type_name<T1>().size())
+  else if constexpr (unqualified_type_name<T2>().size() < unqualified_type_name<T1>().size())
     return v2;
-  else if constexpr (type_name<T1>() < type_name<T2>())
+  else if constexpr (type_name_less<T1, T2>)
     return v1;
   else
     return v2;
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <mp-units/bits/double_double.h>
 #include <mp-units/bits/expression_template.h>
 #include <mp-units/bits/external/hacks.h>
 #include <mp-units/bits/external/type_name.h>
@@ -32,10 +33,13 @@
 #include <mp-units/bits/symbol_text.h>
 #include <mp-units/bits/text_tools.h>
 #include <mp-units/customization_points.h>
+#include <array>
 #include <concepts>
 #include <cstdint>
+#include <limits>
 #include <numbers>
 #include <optional>
+#include <string_view>
 
 namespace mp_units {
 
@@ -263,7 +267,7 @@ template<MagnitudeSpec M>
 template<typename T>
 using widen_t = conditional<std::is_arithmetic_v<T>,
                             conditional<std::is_floating_point_v<T>, long double,
-                                        conditional<std::is_signed_v<T>, std::intmax_t, std::uintmax_t>>,
+                                        conditional<std::is_signed_v<T>, wide_int, wide_uint>>,
                             T>;
 
 // Raise an arbitrary arithmetic type to a positive integer power at compile time.
@@ -329,21 +333,43 @@ template<typename T>
   return int_power(static_cast<widen_t<T>>(get_base_value(el)), power);
 }
 
+// The value of a basis vector raised to its power with the precision of `double_double`.
+[[nodiscard]] consteval double_double double_double_value(MagnitudeSpec auto el)
+{
+  if constexpr (std::is_integral_v<decltype(get_base_value(el))>)
+    return pow(to_double_double(static_cast<std::intmax_t>(get_base_value(el))), get_exponent(el));
+  else {
+    const auto base = static_cast<long double>(get_base_value(el));
+    // the irrational bases are known more precisely than `long double` can store them
+    MP_UNITS_DIAGNOSTIC_PUSH
+    MP_UNITS_DIAGNOSTIC_IGNORE_FLOAT_EQUAL
+    const bool is_pi = base == std::numbers::pi_v<long double>;
+    MP_UNITS_DIAGNOSTIC_POP
+    return pow(is_pi ? pi_double_double : to_double_double(base), get_exponent(el));
+  }
+}
+
 // A converter for the value member variable of magnitude (below).
 //
 // The input is the desired result, but in a (wider) intermediate type.  The point of this function
 // is to cast to the desired type, but avoid overflow in doing so.
 template<typename To, typename From>
 // TODO(chogg): Migrate this to use `treat_as_floating_point`.
-  requires(!std::is_integral_v<To> || std::is_integral_v<From>)
+  requires(!std::is_integral_v<To> || std::is_integral_v<From> || one_of<From, wide_int, wide_uint>)
 [[nodiscard]] consteval To checked_static_cast(From x)
 {
   // This function should only ever be called at compile time.  The purpose of these terminations is
   // to produce compiler errors, because we cannot `static_assert` on function arguments.
   if constexpr (std::is_integral_v<To>) {
-    if (!std::in_range<To>(x)) {
+    // `std::in_range` does not support the 128-bit integers
+    if (x > std::numeric_limits<To>::max()) {
       std::terminate();  // Cannot represent magnitude in this type
     }
+    if constexpr (std::is_signed_v<To>) {
+      if (x < std::numeric_limits<To>::min()) {
+        std::terminate();  // Cannot represent magnitude in this type
+      }
+    }
   }
 
   return static_cast<To>(x);
@@ -509,6 +535,39 @@ inline constexpr bool is_magnitude<T> = true;
 template<auto... Ms>
 inline constexpr bool is_specialization_of_magnitude<magnitude<Ms...>> = true;
 
+// The value of a magnitude with the precision of `double_double`.
+template<auto... Ms>
+[[nodiscard]] consteval double_double double_double_value(magnitude<Ms...>)
+{
+  return (double_double{1.} * ... * double_double_value(Ms));
+}
+
+// An upper bound of `|log2(v)|` of a positive value
+[[nodiscard]] consteval long double abs_log2_upper_bound(long double v)
+{
+  if (v < 1) v = 1 / v;
+  long double res = 1;
+  for (; v >= 2; v /= 2) ++res;
+  return res;
+}
+
+// An upper bound of `|log2|` of the intermediate results of `double_double_value` of a basis vector;
+// the integral powers square their base, so the bound of the value is doubled
+[[nodiscard]] consteval long double double_double_log2_bound(MagnitudeSpec auto el)
+{
+  const ratio exp = get_exponent(el);
+  return 2 * abs_log2_upper_bound(static_cast<long double>(get_base_value(el))) * abs(exp.num) / exp.den;
+}
+
+// Checks if `double_double_value` of a magnitude stays within the exponent range of `double`
+// (the splitting done by the products needs some headroom below the largest `double`)
+template<auto... Ms>
+[[nodiscard]] consteval bool fits_double_double(magnitude<Ms...>)
+{
+  constexpr long double limit = std::numeric_limits<double>::max_exponent - std::numeric_limits<double>::digits;
+  return (0.L + ... + double_double_log2_bound(Ms)) < limit;
+}
+
 }  // namespace detail
 
 
@@ -519,10 +578,17 @@ template<typename T, auto... Ms>
   requires(is_integral(magnitude<Ms...>{})) || treat_as_floating_point<T>
 constexpr T get_value(const magnitude<Ms...>&)
 {
-  // Force the expression to be evaluated in a constexpr context, to catch, e.g., overflow.
-  constexpr auto result = detail::checked_static_cast<T>((detail::compute_base_power<T>(Ms) * ... * T{1}));
+  if constexpr (std::is_floating_point_v<T> && detail::fits_double_double(magnitude<Ms...>{})) {
+    // The value is computed with extended precision and rounded only once to `T`.
+    constexpr auto result = detail::double_double_value(magnitude<Ms...>{}).template to<T>();
 
-  return result;
+    return result;
+  } else {
+    // Force the expression to be evaluated in a constexpr context, to catch, e.g., overflow.
+    constexpr auto result = detail::checked_static_cast<T>((detail::compute_base_power<T>(Ms) * ... * T{1}));
+
+    return result;
+  }
 }
 
 /**
@@ -580,17 +646,106 @@ template<auto... Ms>
 
 namespace detail {
 
-consteval bool less(MagnitudeSpec auto lhs, MagnitudeSpec auto rhs)
-{
-  using lhs_base_t = decltype(get_base_value(lhs));
-  using rhs_base_t = decltype(get_base_value(rhs));
+// The position of an element in a magnitude: named bases go first and are ordered by their types, the numbers follow
+// ordered by their values.
+struct magnitude_element_key {
+  bool named;
+  std::uint64_t name_key;
+  std::uint64_t name_hash;
+  std::string_view name;
+  bool integral;
+  std::intmax_t int_value;
+  long double fp_value;
+  ratio exponent;
+};
 
-  if constexpr (is_named_magnitude<lhs_base_t> && is_named_magnitude<rhs_base_t>)
-    return type_name<lhs_base_t>() < type_name<rhs_base_t>();
-  else if constexpr (!is_named_magnitude<lhs_base_t> && !is_named_magnitude<rhs_base_t>)
-    return get_base_value(lhs) < get_base_value(rhs);
+template<MagnitudeSpec auto M>
+inline constexpr magnitude_element_key magnitude_key = [] {
+  using base_t = decltype(get_base_value(M));
+  if constexpr (is_named_magnitude<base_t>)
+    return magnitude_element_key{true, type_name_key<base_t>, type_name_hash<base_t>, type_name<base_t>(), false, 0,
+                                 0, get_exponent(M)};
+  else if constexpr (std::is_integral_v<base_t>)
+    return magnitude_element_key{false, 0, 0, {}, true, get_base_value(M), 0, get_exponent(M)};
   else
-    return is_named_magnitude<lhs_base_t>;
+    return magnitude_element_key{false, 0, 0, {}, false, 0, static_cast<long double>(get_base_value(M)),
+                                 get_exponent(M)};
+}();
+
+[[nodiscard]] consteval bool less(const magnitude_element_key& lhs, const magnitude_element_key& rhs)
+{
+  if (lhs.named != rhs.named) return lhs.named;
+  if (lhs.named) {
+    if (lhs.name_key != rhs.name_key) return lhs.name_key < rhs.name_key;
+    if (lhs.name_hash != rhs.name_hash) return lhs.name_hash < rhs.name_hash;
+    return lhs.name < rhs.name;
+  }
+  if (lhs.integral && rhs.integral) return lhs.int_value < rhs.int_value;
+  const auto value = [](const magnitude_element_key& k) {
+    return k.integral ? static_cast<long double>(k.int_value) : k.fp_value;
+  };
+  return value(lhs) < value(rhs);
+}
+
+[[nodiscard]] consteval bool same_base(const magnitude_element_key& lhs, const magnitude_element_key& rhs)
+{
+  return lhs.named == rhs.named && lhs.integral == rhs.integral && !less(lhs, rhs) && !less(rhs, lhs);
+}
+
+// The element of a product taken from one of the factors (the other index is `-1`) or combined from both of them.
+struct magnitude_product_source {
+  int lhs = -1;
+  int rhs = -1;
+};
+
+template<std::size_t N>
+struct magnitude_product_sources {
+  std::array<magnitude_product_source, N> sources{};
+  std::size_t size = 0;
+};
+
+template<std::size_t N1, std::size_t N2>
+[[nodiscard]] consteval auto merge_magnitude_elements(const std::array<magnitude_element_key, N1>& lhs,
+                                                      const std::array<magnitude_element_key, N2>& rhs)
+{
+  magnitude_product_sources<N1 + N2> res;
+  std::size_t i = 0, j = 0;
+  while (i < N1 && j < N2) {
+    if (less(lhs[i], rhs[j]))
+      res.sources[res.size++] = {static_cast<int>(i++), -1};
+    else if (less(rhs[j], lhs[i]) || (!same_base(lhs[i], rhs[j]) && !lhs[i].named))
+      res.sources[res.size++] = {-1, static_cast<int>(j++)};
+    else if (!same_base(lhs[i], rhs[j]))
+      res.sources[res.size++] = {static_cast<int>(i++), -1};
+    else {
+      // the elements with the same base are combined and the ones with the zero exponent are dropped
+      if (lhs[i].exponent + rhs[j].exponent != 0) res.sources[res.size++] = {static_cast<int>(i), static_cast<int>(j)};
+      ++i;
+      ++j;
+    }
+  }
+  for (; i < N1; ++i) res.sources[res.size++] = {static_cast<int>(i), -1};
+  for (; j < N2; ++j) res.sources[res.size++] = {-1, static_cast<int>(j)};
+  return res;
+}
+
+template<MagnitudeSpec auto M>
+struct magnitude_element {
+  static constexpr auto value = M;
+};
+
+template<magnitude_product_source S, typename Lhs, typename Rhs>
+[[nodiscard]] consteval auto magnitude_product_element()
+{
+  if constexpr (S.rhs < 0)
+    return type_list_element<Lhs, static_cast<std::size_t>(S.lhs)>::value;
+  else if constexpr (S.lhs < 0)
+    return type_list_element<Rhs, static_cast<std::size_t>(S.rhs)>::value;
+  else {
+    constexpr auto lhs = type_list_element<Lhs, static_cast<std::size_t>(S.lhs)>::value;
+    constexpr auto rhs = type_list_element<Rhs, static_cast<std::size_t>(S.rhs)>::value;
+    return power_v_or_T<get_base(lhs), get_exponent(lhs) + get_exponent(rhs)>();
+  }
 }
 
 }  // namespace detail
@@ -601,42 +756,21 @@ constexpr Magnitude auto operator*(magnitude<>, magnitude<>) { return magnitude<
 constexpr Magnitude auto operator*(magnitude<>, Magnitude auto m) { return m; }
 constexpr Magnitude auto operator*(Magnitude auto m, magnitude<>) { return m; }
 
-// Recursive case for the product of any two non-identity Magnitudes.
+// The product of any two non-identity Magnitudes. The order of the elements is computed at once from their keys rather
+// than with one recursive instantiation per element.
 template<auto H1, auto... T1, auto H2, auto... T2>
 [[nodiscard]] consteval Magnitude auto operator*(magnitude<H1, T1...>, magnitude<H2, T2...>)
 {
   using namespace detail;
 
-  if constexpr (less(H1, H2)) {
-    if constexpr (sizeof...(T1) == 0) {
-      // Shortcut for the "pure prepend" case, which makes it easier to implement some of the other cases.
-      return magnitude<H1, H2, T2...>{};
-    } else {
-      return magnitude<H1>{} * (magnitude<T1...>{} * magnitude<H2, T2...>{});
-    }
-  } else if constexpr (less(H2, H1)) {
-    return magnitude<H2>{} * (magnitude<H1, T1...>{} * magnitude<T2...>{});
-  } else {
-    if constexpr (is_same_v<decltype(get_base(H1)), decltype(get_base(H2))>) {
-      constexpr auto partial_product = magnitude<T1...>{} * magnitude<T2...>{};
-      if constexpr (get_exponent(H1) + get_exponent(H2) == 0) {
-        return partial_product;
-      } else {
-        // Make a new power_v with the common base of H1 and H2, whose power is their powers' sum.
-        constexpr auto new_head = power_v_or_T<get_base(H1), get_exponent(H1) + get_exponent(H2)>();
-
-        if constexpr (get_exponent(new_head) == 0) {
-          return partial_product;
-        } else {
-          return magnitude<new_head>{} * partial_product;
-        }
-      }
-    } else if constexpr (is_named_magnitude<decltype(get_base(H1))>) {
-      return magnitude<H1>{} * (magnitude<T1...>{} * magnitude<H2, T2...>{});
-    } else {
-      return magnitude<H2>{} * (magnitude<H1, T1...>{} * magnitude<T2...>{});
-    }
-  }
+  constexpr auto res =
+    merge_magnitude_elements(std::array{magnitude_key<H1>, magnitude_key<T1>...},
+                             std::array{magnitude_key<H2>, magnitude_key<T2>...});
+  using lhs = type_list<magnitude_element<H1>, magnitude_element<T1>...>;
+  using rhs = type_list<magnitude_element<H2>, magnitude_element<T2>...>;
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return magnitude<magnitude_product_element<res.sources[Is], lhs, rhs>()...>{};
+  }(std::make_index_sequence<res.size>{});
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -765,6 +899,21 @@ template<auto... Ms>
 template<Magnitude auto M>
 using common_magnitude_type = decltype(common_magnitude_type_impl(M));
 
+// Checks if the value of an integral magnitude fits in `std::intmax_t` without computing it
+template<auto... Ms>
+[[nodiscard]] consteval bool fits_in_intmax(magnitude<Ms...>)
+{
+  std::intmax_t value = 1;
+  [[maybe_unused]] const auto multiply = [&](std::intmax_t base, std::intmax_t exp) {
+    for (; exp > 0; --exp) {
+      if (value > std::numeric_limits<std::intmax_t>::max() / base) return false;
+      value *= base;
+    }
+    return true;
+  };
+  return (... && multiply(static_cast<std::intmax_t>(get_base_value(Ms)), get_exponent(Ms).num));
+}
+
 }  // namespace detail
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -840,6 +989,16 @@ template<typename T, auto... Ms>
 
 [[nodiscard]] consteval std::intmax_t integer_part(ratio r) { return r.num / r.den; }
 
+// true if the magnitude is `2^N` for an integral (possibly negative) `N`
+[[nodiscard]] consteval bool is_power_of_2(Magnitude auto m)
+{
+  constexpr auto power = get_power(2, decltype(m){});
+  if constexpr (power.den != 1)
+    return false;
+  else
+    return m == mag_power<2, power>;
+}
+
 [[nodiscard]] consteval std::intmax_t extract_power_of_10(Magnitude auto m)
 {
   const auto power_of_2 = get_power(2, m);
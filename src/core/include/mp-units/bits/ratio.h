@@ -27,6 +27,7 @@
 #include <compare>
 #include <cstdint>
 #include <numeric>
+#include <utility>
 
 namespace mp_units {
 
@@ -38,21 +39,61 @@ template<typename T>
   return v < 0 ? -v : v;
 }
 
-[[nodiscard]] consteval std::intmax_t safe_multiply(std::intmax_t lhs, std::intmax_t rhs)
+// The widest integral types available for the intermediate results of compile-time computations
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef __int128 wide_int;
+__extension__ typedef unsigned __int128 wide_uint;
+#else
+using wide_int = std::intmax_t;
+using wide_uint = std::uintmax_t;
+#endif
+
+[[nodiscard]] MP_UNITS_CONSTEVAL wide_int gcd(wide_int a, wide_int b)
 {
-  constexpr std::intmax_t c = std::uintmax_t(1) << (sizeof(std::intmax_t) * 4);
+  a = abs(a);
+  b = abs(b);
+  while (b != 0) {
+    const wide_int r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
 
-  const std::intmax_t a0 = abs(lhs) % c;
-  const std::intmax_t a1 = abs(lhs) / c;
-  const std::intmax_t b0 = abs(rhs) % c;
-  const std::intmax_t b1 = abs(rhs) / c;
+[[nodiscard]] MP_UNITS_CONSTEVAL std::intmax_t narrow(wide_int v)
+{
+  if constexpr (sizeof(wide_int) > sizeof(std::intmax_t)) {
+    gsl_Assert(v >= INTMAX_MIN && v <= INTMAX_MAX);  // the result does not fit in `std::intmax_t`
+  }
+  return static_cast<std::intmax_t>(v);
+}
 
-  gsl_Assert(a1 == 0 || b1 == 0);                               // overflow in multiplication
-  gsl_Assert(a0 * b1 + b0 * a1 < (c >> 1));                     // overflow in multiplication
-  gsl_Assert(b0 * a0 <= INTMAX_MAX);                            // overflow in multiplication
-  gsl_Assert((a0 * b1 + b0 * a1) * c <= INTMAX_MAX - b0 * a0);  // overflow in multiplication
+[[nodiscard]] consteval std::intmax_t safe_multiply(std::intmax_t lhs, std::intmax_t rhs)
+{
+  if constexpr (sizeof(wide_int) > sizeof(std::intmax_t))
+    return narrow(wide_int{lhs} * rhs);
+  else {
+    constexpr std::intmax_t c = std::uintmax_t(1) << (sizeof(std::intmax_t) * 4);
+
+    const std::intmax_t a0 = abs(lhs) % c;
+    const std::intmax_t a1 = abs(lhs) / c;
+    const std::intmax_t b0 = abs(rhs) % c;
+    const std::intmax_t b1 = abs(rhs) / c;
+
+    gsl_Assert(a1 == 0 || b1 == 0);                               // overflow in multiplication
+    gsl_Assert(a0 * b1 + b0 * a1 < (c >> 1));                     // overflow in multiplication
+    gsl_Assert(b0 * a0 <= INTMAX_MAX);                            // overflow in multiplication
+    gsl_Assert((a0 * b1 + b0 * a1) * c <= INTMAX_MAX - b0 * a0);  // overflow in multiplication
+
+    return lhs * rhs;
+  }
+}
 
-  return lhs * rhs;
+// reduces the fraction computed with wide intermediates to a `ratio`
+[[nodiscard]] MP_UNITS_CONSTEVAL auto make_ratio(wide_int num, wide_int den)
+{
+  const wide_int gcd = detail::gcd(num, den);
+  return std::pair{narrow(num / gcd), narrow(den / gcd)};
 }
 
 }  // namespace detail
@@ -80,13 +121,19 @@ struct ratio {
   }
 
   [[nodiscard]] friend MP_UNITS_CONSTEVAL bool operator==(ratio, ratio) = default;
-  [[nodiscard]] friend MP_UNITS_CONSTEVAL auto operator<=>(ratio lhs, ratio rhs) { return (lhs - rhs).num <=> 0; }
+  [[nodiscard]] friend MP_UNITS_CONSTEVAL auto operator<=>(ratio lhs, ratio rhs)
+  {
+    return detail::wide_int{lhs.num} * rhs.den <=> detail::wide_int{rhs.num} * lhs.den;
+  }
 
   [[nodiscard]] friend MP_UNITS_CONSTEVAL ratio operator-(ratio r) { return ratio{-r.num, r.den}; }
 
   [[nodiscard]] friend MP_UNITS_CONSTEVAL ratio operator+(ratio lhs, ratio rhs)
   {
-    return ratio{lhs.num * rhs.den + lhs.den * rhs.num, lhs.den * rhs.den};
+    const auto [num, den] =
+      detail::make_ratio(detail::wide_int{lhs.num} * rhs.den + detail::wide_int{lhs.den} * rhs.num,
+                         detail::wide_int{lhs.den} * rhs.den);
+    return ratio{num, den};
   }
 
   [[nodiscard]] friend MP_UNITS_CONSTEVAL ratio operator-(ratio lhs, ratio rhs) { return lhs + (-rhs); }
@@ -109,14 +156,10 @@ struct ratio {
   if (r1.num == r2.num && r1.den == r2.den) return ratio{r1.num, r1.den};
 
   // gcd(a/b,c/d) = gcd(a⋅d, c⋅b) / b⋅d
-  gsl_Assert(std::numeric_limits<std::intmax_t>::max() / r1.num > r2.den);
-  gsl_Assert(std::numeric_limits<std::intmax_t>::max() / r2.num > r1.den);
-  gsl_Assert(std::numeric_limits<std::intmax_t>::max() / r1.den > r2.den);
-
-  std::intmax_t num = std::gcd(r1.num * r2.den, r2.num * r1.den);
-  std::intmax_t den = r1.den * r2.den;
-  std::intmax_t gcd = std::gcd(num, den);
-  return ratio{num / gcd, den / gcd};
+  using detail::wide_int;
+  const auto [num, den] =
+    detail::make_ratio(detail::gcd(wide_int{r1.num} * r2.den, wide_int{r2.num} * r1.den), wide_int{r1.den} * r2.den);
+  return ratio{num, den};
 }
 
 }  // namespace mp_units
@@ -26,6 +26,7 @@
 #include <concepts>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <type_traits>
 
 namespace mp_units {
@@ -73,6 +74,16 @@ concept Scalable =
   (requires { typename T::element_type; } && CastableNumber<std::remove_reference_t<typename T::element_type>> &&
    ScalableNumber<T, std::common_type_t<std::remove_reference_t<typename T::element_type>, std::intmax_t>>);
 
+/**
+ * @brief Floating-point types narrower than `float` (e.g. `std::float16_t`)
+ *
+ * Such types are meant for storage; the computations on their values are done in `float`.
+ */
+template<typename T>
+concept NarrowFloatingPoint = treat_as_floating_point<T> && std::numeric_limits<T>::is_specialized &&
+                              (std::numeric_limits<T>::digits < std::numeric_limits<float>::digits) &&
+                              std::convertible_to<T, float>;
+
 }  // namespace detail
 
 template<typename T>
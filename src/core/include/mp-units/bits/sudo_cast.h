@@ -26,7 +26,13 @@
 #include <mp-units/bits/magnitude.h>
 #include <mp-units/bits/quantity_concepts.h>
 #include <mp-units/bits/reference_concepts.h>
+#include <mp-units/bits/representation_concepts.h>
 #include <mp-units/unit.h>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace mp_units::detail {
 
@@ -34,14 +40,108 @@ namespace mp_units::detail {
 template<Quantity From, Quantity To>
 [[nodiscard]] consteval auto common_rep_type(From, To)
 {
-  if constexpr (requires { typename std::common_type_t<typename From::rep, typename To::rep>; })
+  if constexpr (requires { typename std::common_type_t<typename From::rep, typename To::rep>; }) {
     // returns a common type of two representation types if available
     // e.g. `double` and `int` will end up with `double` precision
-    return std::common_type_t<typename From::rep, typename To::rep>{};
+    using type = std::common_type_t<typename From::rep, typename To::rep>;
+    // storage-only floating-point types are promoted to not round the value twice
+    if constexpr (NarrowFloatingPoint<type>)
+      return float{};
+    else
+      return type{};
+  } else if constexpr (NarrowFloatingPoint<typename From::rep> && NarrowFloatingPoint<typename To::rep>)
+    // e.g. `std::float16_t` and `std::bfloat16_t` do not have a common type
+    return float{};
   else
     return typename From::rep{};
 }
 
+/**
+ * @brief Representation types that scale by powers of 2 with shift operators
+ *
+ * `v << n` and `v >> n` have to be equivalent to `v * 2^n` and `v / 2^n` respectively, including
+ * the truncation of the division towards zero. Built-in integral types do not satisfy it because
+ * their right shift of a negative value rounds towards negative infinity.
+ */
+template<typename T>
+concept ShiftScalable = (!std::integral<T>) && requires(const T& v, int n) {
+  {
+    v << n
+  } -> std::convertible_to<T>;
+  {
+    v >> n
+  } -> std::convertible_to<T>;
+};
+
+// multiplies the value by `2^Exp` with shifts rather than with a multiplication or a division
+template<std::intmax_t Exp, typename T>
+[[nodiscard]] constexpr T shift_scale(const T& v)
+{
+  if constexpr (std::integral<T>) {
+    if constexpr (Exp > 0)
+      return static_cast<T>(static_cast<std::make_unsigned_t<T>>(v) << Exp);
+    else if constexpr (std::is_signed_v<T>) {
+      // adding `2^-Exp - 1` to the negative values truncates the result towards zero like a division does
+      constexpr T bias = static_cast<T>((T{1} << -Exp) - 1);
+      return static_cast<T>((v < 0 ? v + bias : v) >> -Exp);
+    } else
+      return static_cast<T>(v >> -Exp);
+  } else if constexpr (Exp > 0)
+    return static_cast<T>(v << static_cast<int>(Exp));
+  else
+    return static_cast<T>(v >> static_cast<int>(-Exp));
+}
+
+template<typename T, std::intmax_t Exp>
+concept ShiftScalableBy =
+  (std::integral<T> && (Exp > -std::numeric_limits<T>::digits) && (Exp < std::numeric_limits<T>::digits)) ||
+  ShiftScalable<T>;
+
+// the integral ratios which numerator or denominator do not fit in `std::intmax_t` are computed with 128-bit integers
+template<Magnitude auto M>
+inline constexpr bool needs_wide_scaling =
+  is_rational(M) && !(fits_in_intmax(numerator(M)) && fits_in_intmax(denominator(M)));
+
+// the type of the factor that scales the values of the representation type `T` by the magnitude `M`
+// (the factors of the `std` floating-point types are correctly rounded to the type itself so that
+// no `long double` arithmetic is done at runtime)
+template<typename T, Magnitude auto M>
+using scaling_factor_type =
+  conditional<std::is_floating_point_v<T>, T,
+              conditional<treat_as_floating_point<T>, std::common_type_t<common_magnitude_type<M>, long double>,
+                          conditional<needs_wide_scaling<M>, wide_int, common_magnitude_type<M>>>>;
+
+// the scaling by `M` is done with shifts rather than with a multiplication and a division
+template<typename T, typename Factor, Magnitude auto M>
+concept ShiftScaledBy =
+  is_power_of_2(M) && ShiftScalableBy<decltype(std::declval<T>() * std::declval<Factor>()), get_power(2, M).num>;
+
+/**
+ * @brief Representation types which values `sudo_cast` can scale by the magnitude `M`
+ *
+ * Spells out the operations done by `sudo_cast` so that checking them does not instantiate its body.
+ *
+ * @tparam FromRep the representation type of the source quantity
+ * @tparam ToRep the representation type of the target quantity
+ * @tparam T the representation type used for the computations
+ */
+template<typename FromRep, typename ToRep, typename T, Magnitude auto M, typename Factor = scaling_factor_type<T, M>>
+concept ScalableBy =
+  (ShiftScaledBy<T, Factor, M> && requires(const FromRep& v, const Factor& f) {
+    static_cast<ToRep>(
+      shift_scale<get_power(2, M).num>(static_cast<decltype(static_cast<T>(v) * f)>(static_cast<T>(v))));
+  }) || (!ShiftScaledBy<T, Factor, M> && requires(const FromRep& v, const Factor& f) {
+    static_cast<ToRep>(static_cast<T>(v) * f / f * f);
+  });
+
+template<typename From, typename To>
+concept SudoCastable =
+  Quantity<From> && Quantity<To> && castable(From::quantity_spec, To::quantity_spec) &&
+  ((From::unit == To::unit && std::constructible_from<typename To::rep, typename From::rep>) ||
+   (From::unit != To::unit &&
+    ScalableBy<typename From::rep, typename To::rep, decltype(common_rep_type(From{}, To{})),
+               get_canonical_unit(From::unit).mag / get_canonical_unit(To::unit).mag>));
+
 /**
  * @brief Explicit cast between different quantity types
  *
@@ -51,13 +151,8 @@ template<Quantity From, Quantity To>
  * @tparam To a target quantity type to cast to
  */
 template<Quantity To, typename From>
-  requires Quantity<std::remove_cvref_t<From>> &&
-           (castable(std::remove_reference_t<From>::quantity_spec, To::quantity_spec)) &&
-           ((std::remove_reference_t<From>::unit == To::unit &&
-             std::constructible_from<typename To::rep, typename std::remove_reference_t<From>::rep>) ||
-            (std::remove_reference_t<From>::unit != To::unit))  // && scalable_with_<typename To::rep>))
-// TODO how to constrain the second part here?
-[[nodiscard]] constexpr Quantity auto sudo_cast(From&& q)
+  requires SudoCastable<std::remove_cvref_t<From>, To>
+[[nodiscard]] constexpr To sudo_cast(From&& q)
 {
   constexpr auto q_unit = std::remove_reference_t<From>::unit;
   if constexpr (q_unit == To::unit) {
@@ -74,13 +169,49 @@ template<Quantity To, typename From>
     constexpr Magnitude auto den = denominator(c_mag);
     constexpr Magnitude auto irr = c_mag * (den / num);
     using c_rep_type = decltype(common_rep_type(q, To{}));
-    using c_mag_type = common_magnitude_type<c_mag>;
-    using multiplier_type =
-      conditional<treat_as_floating_point<c_rep_type>, std::common_type_t<c_mag_type, long double>, c_mag_type>;
+    using multiplier_type = scaling_factor_type<c_rep_type, c_mag>;
     constexpr auto val = [](Magnitude auto m) { return get_value<multiplier_type>(m); };
-    return static_cast<MP_UNITS_TYPENAME To::rep>(static_cast<c_rep_type>(std::forward<From>(q).numerical_value_) *
-                                                  val(num) / val(den) * val(irr)) *
-           To::reference;
+    using calc_type = decltype(std::declval<c_rep_type>() * val(num));
+    if constexpr (ShiftScaledBy<c_rep_type, multiplier_type, c_mag>) {
+      // binary prefixes and ratios like `byte = mag<8> * bit` do not need a multiplication nor a division
+      return static_cast<MP_UNITS_TYPENAME To::rep>(shift_scale<get_power(2, c_mag).num>(
+               static_cast<calc_type>(static_cast<c_rep_type>(std::forward<From>(q).numerical_value_)))) *
+             To::reference;
+    } else if constexpr (std::is_floating_point_v<c_rep_type> && fits_double_double(c_mag)) {
+      // the factors are evaluated at compile time with extended precision and rounded once to `multiplier_type`
+      constexpr double_double factor = double_double_value(c_mag);
+      constexpr auto hi = factor.template to<multiplier_type>();
+      constexpr double_double inverse = double_double_value(mag<1> / c_mag);
+      constexpr auto inverse_hi = inverse.template to<multiplier_type>();
+      MP_UNITS_DIAGNOSTIC_PUSH
+      MP_UNITS_DIAGNOSTIC_IGNORE_FLOAT_EQUAL
+      constexpr bool exact = (factor - to_double_double(static_cast<long double>(hi))).hi == 0.;
+      constexpr bool exact_inverse = (inverse - to_double_double(static_cast<long double>(inverse_hi))).hi == 0.;
+      MP_UNITS_DIAGNOSTIC_POP
+      const auto v = static_cast<c_rep_type>(std::forward<From>(q).numerical_value_);
+      if constexpr (exact)
+        return static_cast<MP_UNITS_TYPENAME To::rep>(v * hi) * To::reference;
+      else if constexpr (exact_inverse)
+        // a single correctly rounded operation (e.g. `m -> km`)
+        return static_cast<MP_UNITS_TYPENAME To::rep>(v / inverse_hi) * To::reference;
+      else {
+#ifdef MP_UNITS_COMPENSATED_SCALING
+        // opt-in: the rounding of the factor is compensated with its residual at the cost of Dekker's exact product
+        constexpr auto lo = (factor - to_double_double(static_cast<long double>(hi))).template to<multiplier_type>();
+        return static_cast<MP_UNITS_TYPENAME To::rep>(compensated_product(v, hi, lo)) * To::reference;
+#else
+        if constexpr (is_rational(c_mag))
+          return static_cast<MP_UNITS_TYPENAME To::rep>(v * hi) * To::reference;
+        else
+          // the rational part is applied first so that its exact multiples (e.g. `180 deg`) give the correctly
+          // rounded value of the irrational one (e.g. `pi rad`)
+          return static_cast<MP_UNITS_TYPENAME To::rep>(v * val(num) / val(den) * val(irr)) * To::reference;
+#endif
+      }
+    } else
+      return static_cast<MP_UNITS_TYPENAME To::rep>(static_cast<c_rep_type>(std::forward<From>(q).numerical_value_) *
+                                                    val(num) / val(den) * val(irr)) *
+             To::reference;
   }
 }
 
@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/quantity_concepts.h>
+#include <mp-units/bits/reference_concepts.h>
+#include <mp-units/bits/representation_concepts.h>
+#include <mp-units/quantity.h>
+#include <mp-units/reference.h>
+#include <mp-units/unit.h>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace mp_units {
+
+/**
+ * @brief A quantity with a value known at compile time
+ *
+ * Unlike `Value * R`, a constant quantity does not store its value.  In the arithmetic with regular
+ * quantities and numbers the value is folded into the magnitude of the unit of the result, so only
+ * the references change and the numerical values are not touched.  All the constants of a formula
+ * are then applied with a single multiplication when its result is converted to another unit.
+ *
+ * @code{.cpp}
+ * inline constexpr constant_quantity<1, si::si2019::speed_of_light_in_vacuum> c;
+ * quantity<si::metre> d = 2. * si::second * c;  // one multiplication by `299'792'458`
+ * @endcode
+ *
+ * @tparam Value the positive value of the constant
+ * @tparam R a reference of the constant providing all information about quantity properties
+ */
+template<auto Value, Reference auto R>
+  requires std::integral<decltype(Value)> && (Value > 0) &&
+           RepresentationOf<std::remove_const_t<decltype(Value)>, get_quantity_spec(R).character>
+class constant_quantity {
+public:
+  // member types and values
+  static constexpr Reference auto reference = R;
+  static constexpr QuantitySpec auto quantity_spec = get_quantity_spec(reference);
+  static constexpr Dimension auto dimension = quantity_spec.dimension;
+  static constexpr Unit auto unit = get_unit(reference);
+  using rep = std::remove_const_t<decltype(Value)>;
+  static constexpr rep value = Value;
+
+  // the reference of the constant with its value folded into the magnitude of the unit
+  static constexpr Reference auto folded_reference =
+    detail::clone_reference_with<mag<static_cast<std::intmax_t>(Value)> * unit>(reference);
+
+  // conversions
+  [[nodiscard]] constexpr operator quantity<R, rep>() const { return value * R; }
+};
+
+namespace detail {
+
+template<typename T>
+inline constexpr bool is_specialization_of_constant_quantity = false;
+
+template<auto Value, auto R>
+inline constexpr bool is_specialization_of_constant_quantity<constant_quantity<Value, R>> = true;
+
+template<typename T>
+concept ConstantQuantity = is_specialization_of_constant_quantity<T>;
+
+}  // namespace detail
+
+template<detail::ConstantQuantity C1, detail::ConstantQuantity C2>
+[[nodiscard]] constexpr detail::ConstantQuantity auto operator*(C1, C2)
+{
+  return constant_quantity<std::common_type_t<typename C1::rep, typename C2::rep>{1},
+                           C1::folded_reference * C2::folded_reference>{};
+}
+
+template<detail::ConstantQuantity C1, detail::ConstantQuantity C2>
+[[nodiscard]] constexpr detail::ConstantQuantity auto operator/(C1, C2)
+{
+  return constant_quantity<std::common_type_t<typename C1::rep, typename C2::rep>{1},
+                           C1::folded_reference / C2::folded_reference>{};
+}
+
+template<Quantity Q, detail::ConstantQuantity C>
+[[nodiscard]] constexpr Quantity auto operator*(const Q& q, C)
+{
+  return q * C::folded_reference;
+}
+
+template<detail::ConstantQuantity C, Quantity Q>
+[[nodiscard]] constexpr Quantity auto operator*(C, const Q& q)
+{
+  return q * C::folded_reference;
+}
+
+template<Quantity Q, detail::ConstantQuantity C>
+[[nodiscard]] constexpr Quantity auto operator/(const Q& q, C)
+{
+  return q / C::folded_reference;
+}
+
+// the value of the constant is folded only for floating-point quantities; for integral ones `1 / q` would
+// truncate to zero, so the value itself is divided (`Value / q`), which truncates like the division of any
+// other integral quantities
+template<detail::ConstantQuantity C, Quantity Q>
+[[nodiscard]] constexpr Quantity auto operator/(C c, const Q& q)
+{
+  if constexpr (treat_as_floating_point<typename Q::rep>)
+    return typename C::rep{1} / q * C::folded_reference;
+  else
+    return quantity<C::reference, typename C::rep>(c) / q;
+}
+
+template<typename Value, detail::ConstantQuantity C>
+  requires RepresentationOf<std::remove_cvref_t<Value>, C::quantity_spec.character>
+[[nodiscard]] constexpr Quantity auto operator*(Value&& v, C)
+{
+  return std::forward<Value>(v) * C::folded_reference;
+}
+
+template<detail::ConstantQuantity C, typename Value>
+  requires RepresentationOf<std::remove_cvref_t<Value>, C::quantity_spec.character>
+[[nodiscard]] constexpr Quantity auto operator*(C, Value&& v)
+{
+  return std::forward<Value>(v) * C::folded_reference;
+}
+
+template<typename Value, detail::ConstantQuantity C>
+  requires RepresentationOf<std::remove_cvref_t<Value>, C::quantity_spec.character>
+[[nodiscard]] constexpr Quantity auto operator/(Value&& v, C)
+{
+  return std::forward<Value>(v) / C::folded_reference;
+}
+
+/**
+ * @brief Computes the value of a constant quantity raised to the `Num/Den` power
+ *
+ * @tparam Num Exponent numerator
+ * @tparam Den Exponent denominator
+ * @param c Constant quantity being the base of the operation
+ *
+ * @return Constant quantity
+ */
+template<std::intmax_t Num, std::intmax_t Den = 1, detail::ConstantQuantity C>
+  requires detail::non_zero<Den>
+[[nodiscard]] constexpr detail::ConstantQuantity auto pow(C)
+{
+  return constant_quantity<typename C::rep{1}, pow<Num, Den>(C::folded_reference)>{};
+}
+
+}  // namespace mp_units
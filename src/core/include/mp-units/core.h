@@ -23,6 +23,7 @@
 #pragma once
 
 #include <mp-units/concepts.h>
+#include <mp-units/constant_quantity.h>
 #include <mp-units/customization_points.h>
 #include <mp-units/dimension.h>
 #include <mp-units/quantity.h>
@@ -33,6 +33,8 @@
 #include <mp-units/customization_points.h>
 #include <mp-units/reference.h>
 #include <compare>
+#include <concepts>
+#include <cstdint>
 #include <utility>
 
 // the below is not used in this header but should be exposed with it
@@ -53,9 +55,7 @@ concept QuantityConvertibleTo =
   convertible(QFrom::unit, QTo::unit) &&
   (treat_as_floating_point<typename QTo::rep> ||
    (!treat_as_floating_point<typename QFrom::rep> && IntegralConversionFactor<QFrom::unit, QTo::unit>)) &&
-  // TODO consider providing constraints of sudo_cast here rather than testing if it can be called (its return type is
-  // deduced thus the function is evaluated here and may emit truncating conversion or other warnings)
-  requires(QFrom q) { detail::sudo_cast<QTo>(q); };
+  SudoCastable<QFrom, QTo>;
 
 template<quantity_character Ch, typename Func, typename T, typename U>
 concept InvokeResultOf = std::regular_invocable<Func, T, U> && RepresentationOf<std::invoke_result_t<Func, T, U>, Ch>;
@@ -71,6 +71,17 @@ template<typename Func, Quantity Q1, Quantity Q2>
 using common_quantity_for = quantity<common_reference(Q1::reference, Q2::reference),
                                      std::invoke_result_t<Func, typename Q1::rep, typename Q2::rep>>;
 
+// the numerical value of `q` in the unit and the representation type of `To`
+// (only a quantity expressed in a different unit is scaled)
+template<Quantity To, Quantity From>
+[[nodiscard]] constexpr MP_UNITS_TYPENAME To::rep numerical_value_for(const From& q)
+{
+  if constexpr (From::unit == To::unit)
+    return static_cast<MP_UNITS_TYPENAME To::rep>(q.numerical_value_);
+  else
+    return sudo_cast<To>(q).numerical_value_;
+}
+
 }  // namespace detail
 
 /**
@@ -306,6 +317,34 @@ public:
     return std::forward<Q>(lhs);
   }
 
+  // the quantities in other units are scaled to the unit of `lhs` with a factor folded at compile time
+  // (quantity-like types still use the overloads above through the converting constructor)
+  template<typename Q, detail::QuantityConvertibleTo<quantity> Q2>
+    requires std::derived_from<std::remove_cvref_t<Q>, quantity> && (!std::same_as<Q2, quantity>) &&
+             requires(rep a, rep b) {
+               {
+                 a += b
+               } -> std::same_as<rep&>;
+             }
+  friend constexpr decltype(auto) operator+=(Q&& lhs, const Q2& rhs)
+  {
+    lhs.numerical_value_ += detail::numerical_value_for<quantity>(rhs);
+    return std::forward<Q>(lhs);
+  }
+
+  template<typename Q, detail::QuantityConvertibleTo<quantity> Q2>
+    requires std::derived_from<std::remove_cvref_t<Q>, quantity> && (!std::same_as<Q2, quantity>) &&
+             requires(rep a, rep b) {
+               {
+                 a -= b
+               } -> std::same_as<rep&>;
+             }
+  friend constexpr decltype(auto) operator-=(Q&& lhs, const Q2& rhs)
+  {
+    lhs.numerical_value_ -= detail::numerical_value_for<quantity>(rhs);
+    return std::forward<Q>(lhs);
+  }
+
   template<typename Q>
     requires std::derived_from<std::remove_cvref_t<Q>, quantity> && (!treat_as_floating_point<rep>) &&
              requires(rep a, rep b) {
@@ -396,13 +435,55 @@ explicit(
   is_specialization_of<decltype(quantity_like_traits<Q>::to_numerical_value(std::declval<Q>())), convert_explicitly>)
   quantity(Q) -> quantity<quantity_like_traits<Q>::reference, typename quantity_like_traits<Q>::rep>;
 
+namespace detail {
+
+// integral quantities in the units of a rational ratio `n/d` are compared as `lhs * n` and `rhs * d`
+// computed with twice the width of `std::intmax_t` (`wide_int`), so no division is needed and the products
+// of any 64-bit values cannot overflow (on the platforms without 128-bit integers `wide_int` is only
+// `std::intmax_t` and the values above `INTMAX_MAX / n` still overflow)
+template<Quantity Q1, Quantity Q2, typename Rep>
+[[nodiscard]] consteval bool cross_multipliable()
+{
+  if constexpr (std::integral<Rep>) {
+    constexpr Magnitude auto r = get_canonical_unit(Q1::unit).mag / get_canonical_unit(Q2::unit).mag;
+    return is_rational(r) && fits_in_intmax(numerator(r)) && fits_in_intmax(denominator(r));
+  } else
+    return false;
+}
+
+template<Magnitude auto M, typename T>
+[[nodiscard]] constexpr T cross_multiplied(T v)
+{
+  if constexpr (M == mag<1>)
+    return v;
+  else
+    return v * static_cast<T>(get_value<std::intmax_t>(M));
+}
+
+// the numerical values of two quantities that can be compared with each other
+template<Quantity Q1, Quantity Q2>
+[[nodiscard]] constexpr auto comparable_numerical_values(const Q1& lhs, const Q2& rhs)
+{
+  using ct = std::common_type_t<Q1, Q2>;
+  using rep = MP_UNITS_TYPENAME ct::rep;
+  if constexpr (cross_multipliable<Q1, Q2, rep>()) {
+    using calc_type = std::common_type_t<rep, std::conditional_t<std::is_signed_v<rep>, wide_int, wide_uint>>;
+    constexpr Magnitude auto r = get_canonical_unit(Q1::unit).mag / get_canonical_unit(Q2::unit).mag;
+    return std::pair{cross_multiplied<numerator(r)>(static_cast<calc_type>(static_cast<rep>(lhs.numerical_value_))),
+                     cross_multiplied<denominator(r)>(static_cast<calc_type>(static_cast<rep>(rhs.numerical_value_)))};
+  } else
+    return std::pair{numerical_value_for<ct>(lhs), numerical_value_for<ct>(rhs)};
+}
+
+}  // namespace detail
+
 // binary operators on quantities
 template<auto R1, typename Rep1, auto R2, typename Rep2>
   requires detail::InvocableQuantities<std::plus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>
 [[nodiscard]] constexpr Quantity auto operator+(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
 {
   using ret = detail::common_quantity_for<std::plus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
-  return make_quantity<ret::reference>(ret(lhs).numerical_value_ + ret(rhs).numerical_value_);
+  return make_quantity<ret::reference>(detail::numerical_value_for<ret>(lhs) + detail::numerical_value_for<ret>(rhs));
 }
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
@@ -410,7 +491,7 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 [[nodiscard]] constexpr Quantity auto operator-(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
 {
   using ret = detail::common_quantity_for<std::minus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
-  return make_quantity<ret::reference>(ret(lhs).numerical_value_ - ret(rhs).numerical_value_);
+  return make_quantity<ret::reference>(detail::numerical_value_for<ret>(lhs) - detail::numerical_value_for<ret>(rhs));
 }
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
@@ -420,7 +501,7 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
 {
   gsl_ExpectsAudit(rhs != rhs.zero());
   using ret = detail::common_quantity_for<std::modulus<>, quantity<R1, Rep1>, quantity<R2, Rep2>>;
-  return make_quantity<ret::reference>(ret(lhs).numerical_value_ % ret(rhs).numerical_value_);
+  return make_quantity<ret::reference>(detail::numerical_value_for<ret>(lhs) % detail::numerical_value_for<ret>(rhs));
 }
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
@@ -477,8 +558,8 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
            std::equality_comparable<typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>::rep>
 [[nodiscard]] constexpr bool operator==(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
 {
-  using ct = std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>;
-  return ct(lhs).numerical_value_ == ct(rhs).numerical_value_;
+  const auto [l, r] = detail::comparable_numerical_values(lhs, rhs);
+  return l == r;
 }
 
 template<auto R1, typename Rep1, auto R2, typename Rep2>
@@ -486,8 +567,8 @@ template<auto R1, typename Rep1, auto R2, typename Rep2>
            std::three_way_comparable<typename std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>::rep>
 [[nodiscard]] constexpr auto operator<=>(const quantity<R1, Rep1>& lhs, const quantity<R2, Rep2>& rhs)
 {
-  using ct = std::common_type_t<quantity<R1, Rep1>, quantity<R2, Rep2>>;
-  return ct(lhs).numerical_value_ <=> ct(rhs).numerical_value_;
+  const auto [l, r] = detail::comparable_numerical_values(lhs, rhs);
+  return l <=> r;
 }
 
 // make_quantity
@@ -91,7 +91,7 @@ template<auto... Args>
 }
 
 template<NamedQuantitySpec Lhs, NamedQuantitySpec Rhs>
-struct quantity_spec_less : std::bool_constant<type_name<Lhs>() < type_name<Rhs>()> {};
+struct quantity_spec_less : std::bool_constant<type_name_less<Lhs, Rhs>> {};
 
 template<typename T1, typename T2>
 using type_list_of_quantity_spec_less = expr_less<T1, T2, quantity_spec_less>;
@@ -590,6 +590,20 @@ namespace detail {
 
 enum class specs_convertible_result { no, cast, explicit_conversion, yes };
 
+template<QuantitySpec From, QuantitySpec To>
+[[nodiscard]] consteval specs_convertible_result convertible_impl(From from, To to);
+
+// the results are cached per pair of quantity specifications as every construction and arithmetic
+// operation of quantities checks them
+template<QuantitySpec From, QuantitySpec To>
+inline constexpr specs_convertible_result convertible_result = convertible_impl(From{}, To{});
+
+template<QuantitySpec From, QuantitySpec To>
+[[nodiscard]] consteval specs_convertible_result convertible(From, To)
+{
+  return convertible_result<From, To>;
+}
+
 template<QuantitySpec Q>
 [[nodiscard]] consteval int get_complexity(Q);
 
@@ -622,8 +636,11 @@ template<QuantitySpec Q>
     return 1;
 }
 
+template<typename T>
+inline constexpr int complexity = get_complexity(T{});
+
 // dimension_one is always the last one
-// otherwise, sort by typename
+// otherwise, sort by the type name ordering key
 template<Dimension D1, Dimension D2>
 [[nodiscard]] consteval bool ingredients_dimension_less(D1 lhs, D2 rhs)
 {
@@ -634,17 +651,17 @@ template<Dimension D1, Dimension D2>
   else if constexpr (rhs == dimension_one)
     return true;
   else
-    return type_name<D1>() < type_name<D2>();
+    return type_name_less<D1, D2>;
 }
 
 template<QuantitySpec Lhs, QuantitySpec Rhs, bool lhs_eq = requires { Lhs::_equation_; },
-         bool rhs_eq = requires { Rhs::_equation_; }, ratio lhs_compl = get_complexity(Lhs{}),
-         ratio rhs_compl = get_complexity(Rhs{})>
+         bool rhs_eq = requires { Rhs::_equation_; }, ratio lhs_compl = complexity<Lhs>,
+         ratio rhs_compl = complexity<Rhs>>
 struct ingredients_less :
     std::bool_constant<(lhs_compl > rhs_compl) ||
                        (lhs_compl == rhs_compl && ingredients_dimension_less(Lhs::dimension, Rhs::dimension)) ||
                        (lhs_compl == rhs_compl && Lhs::dimension == Rhs::dimension &&
-                        type_name<Lhs>() < type_name<Rhs>())> {};
+                        type_name_less<Lhs, Rhs>)> {};
 
 template<typename T1, typename T2>
 using type_list_of_ingredients_less = expr_less<T1, T2, ingredients_less>;
@@ -690,6 +707,9 @@ template<QuantitySpec Q, int... Ints>
     defines_equation(Q{}) ? specs_convertible_result::yes : specs_convertible_result::explicit_conversion};
 }
 
+template<typename T>
+inline constexpr auto exploded_equation = explode_to_equation(T{});
+
 template<QuantitySpec Q>
 struct explode_result {
   Q quantity;
@@ -715,11 +735,15 @@ template<int Complexity, IntermediateDerivedQuantitySpec Q>
 template<int Complexity, NamedQuantitySpec Q>
 [[nodiscard]] consteval auto explode(Q q);
 
+// the exploded forms are cached per quantity specification and complexity
+template<int Complexity, QuantitySpec Q>
+inline constexpr auto exploded = explode<Complexity>(Q{});
+
 template<int Complexity, QuantitySpec Q, typename Num, typename... Nums, typename Den, typename... Dens>
 [[nodiscard]] consteval auto explode(Q, type_list<Num, Nums...>, type_list<Den, Dens...>)
 {
-  constexpr auto n = get_complexity(Num{});
-  constexpr auto d = get_complexity(Den{});
+  constexpr auto n = complexity<Num>;
+  constexpr auto d = complexity<Den>;
   constexpr auto max_compl = n > d ? n : d;
 
   if constexpr (max_compl == Complexity || ((n >= d && !requires { explode_to_equation(Num{}); }) ||
@@ -727,12 +751,12 @@ template<int Complexity, QuantitySpec Q, typename Num, typename... Nums, typenam
     return explode_result{(map_power(Num{}) * ... * map_power(Nums{})) / (map_power(Den{}) * ... * map_power(Dens{}))};
   else {
     if constexpr (n >= d) {
-      constexpr auto res = explode_to_equation(Num{});
+      constexpr auto res = exploded_equation<Num>;
       return explode<Complexity>((res.equation * ... * map_power(Nums{})) /
                                  (map_power(Den{}) * ... * map_power(Dens{})))
         .common_convertibility_with(res);
     } else {
-      constexpr auto res = explode_to_equation(Den{});
+      constexpr auto res = exploded_equation<Den>;
       return explode<Complexity>((map_power(Num{}) * ... * map_power(Nums{})) /
                                  (res.equation * ... * map_power(Dens{})))
         .common_convertibility_with(res);
@@ -743,11 +767,11 @@ template<int Complexity, QuantitySpec Q, typename Num, typename... Nums, typenam
 template<int Complexity, QuantitySpec Q, typename Num, typename... Nums>
 [[nodiscard]] consteval auto explode(Q, type_list<Num, Nums...>, type_list<>)
 {
-  constexpr auto n = get_complexity(Num{});
+  constexpr auto n = complexity<Num>;
   if constexpr (n == Complexity || !requires { explode_to_equation(Num{}); })
     return explode_result{(map_power(Num{}) * ... * map_power(Nums{}))};
   else {
-    constexpr auto res = explode_to_equation(Num{});
+    constexpr auto res = exploded_equation<Num>;
     return explode<Complexity>((res.equation * ... * map_power(Nums{}))).common_convertibility_with(res);
   }
 }
@@ -755,11 +779,11 @@ template<int Complexity, QuantitySpec Q, typename Num, typename... Nums>
 template<int Complexity, QuantitySpec Q, typename Den, typename... Dens>
 [[nodiscard]] consteval auto explode(Q, type_list<>, type_list<Den, Dens...>)
 {
-  constexpr auto d = get_complexity(Den{});
+  constexpr auto d = complexity<Den>;
   if constexpr (d == Complexity || !requires { explode_to_equation(Den{}); })
     return explode_result{dimensionless / (map_power(Den{}) * ... * map_power(Dens{}))};
   else {
-    constexpr auto res = explode_to_equation(Den{});
+    constexpr auto res = exploded_equation<Den>;
     return explode<Complexity>(dimensionless / (res.equation * ... * map_power(Dens{})))
       .common_convertibility_with(res);
   }
@@ -774,7 +798,7 @@ template<int Complexity, QuantitySpec Q>
 template<int Complexity, IntermediateDerivedQuantitySpec Q>
 [[nodiscard]] consteval auto explode(Q q)
 {
-  constexpr auto c = get_complexity(Q{});
+  constexpr auto c = complexity<Q>;
   if constexpr (c > Complexity)
     return explode<Complexity>(q, type_list_sort<typename Q::_num_, type_list_of_ingredients_less>{},
                                type_list_sort<typename Q::_den_, type_list_of_ingredients_less>{});
@@ -785,10 +809,10 @@ template<int Complexity, IntermediateDerivedQuantitySpec Q>
 template<int Complexity, NamedQuantitySpec Q>
 [[nodiscard]] consteval auto explode(Q q)
 {
-  constexpr auto c = get_complexity(Q{});
+  constexpr auto c = complexity<Q>;
   if constexpr (c > Complexity && requires { Q::_equation_; }) {
-    constexpr auto res = explode_to_equation(Q{});
-    return explode<Complexity>(res.equation).common_convertibility_with(res);
+    constexpr auto res = exploded_equation<Q>;
+    return exploded<Complexity, std::remove_const_t<decltype(res.equation)>>.common_convertibility_with(res);
   } else
     return explode_result{q};
 }
@@ -926,7 +950,7 @@ template<process_entities Entities, auto Ext, TypeList NumFrom, TypeList DenFrom
                                                                    DenTo den_to)
 {
   if constexpr (Entities == process_entities::numerators || Entities == process_entities::denominators) {
-    constexpr auto res = convertible_impl(Ext.from, Ext.to);
+    constexpr auto res = convertible(Ext.from, Ext.to);
     if constexpr (Ext.prepend == prepend_rest::no)
       return min(res, are_ingredients_convertible(num_from, den_from, num_to, den_to));
     else {
@@ -983,34 +1007,34 @@ template<typename NumFrom, typename... NumsFrom, typename DenFrom, typename... D
     return process_extracted<process_entities::to, extT>(num_from, den_from, type_list<NumsTo...>{},
                                                          type_list<DensTo...>{});
   else {
-    constexpr auto num_from_compl = get_complexity(NumFrom{});
-    constexpr auto den_from_compl = get_complexity(DenFrom{});
-    constexpr auto num_to_compl = get_complexity(NumTo{});
-    constexpr auto den_to_compl = get_complexity(DenTo{});
+    constexpr auto num_from_compl = complexity<NumFrom>;
+    constexpr auto den_from_compl = complexity<DenFrom>;
+    constexpr auto num_to_compl = complexity<NumTo>;
+    constexpr auto den_to_compl = complexity<DenTo>;
     constexpr auto max_compl = max({num_from_compl, num_to_compl, den_from_compl, den_to_compl});
     if constexpr (max_compl > 1) {
       if constexpr (num_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<NumFrom>;
+        return convertible(
           (res.equation * ... * map_power(NumsFrom{})) / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})) / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else if constexpr (den_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(DenFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<DenFrom>;
+        return convertible(
           (map_power(NumFrom{}) * ... * map_power(NumsFrom{})) / (res.equation * ... * map_power(DensFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})) / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else if constexpr (num_to_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
-                                                  (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                (res.equation * ... * map_power(NumsTo{})) /
-                                                  (map_power(DenTo{}) * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<NumTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
+                                             (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           (res.equation * ... * map_power(NumsTo{})) /
+                                             (map_power(DenTo{}) * ... * map_power(DensTo{}))));
       } else {
-        constexpr auto res = explode_to_equation(DenTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
-                                                  (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
-                                                  (res.equation * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<DenTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
+                                             (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
+                                             (res.equation * ... * map_power(DensTo{}))));
       }
     }
   }
@@ -1030,26 +1054,26 @@ template<typename DenFrom, typename... DensFrom, typename NumTo, typename... Num
     return process_extracted<process_entities::to, extT>(num_from, den_from, type_list<NumsTo...>{},
                                                          type_list<DensTo...>{});
   else {
-    constexpr auto den_from_compl = get_complexity(DenFrom{});
-    constexpr auto num_to_compl = get_complexity(NumTo{});
-    constexpr auto den_to_compl = get_complexity(DenTo{});
+    constexpr auto den_from_compl = complexity<DenFrom>;
+    constexpr auto num_to_compl = complexity<NumTo>;
+    constexpr auto den_to_compl = complexity<DenTo>;
     constexpr auto max_compl = max({num_to_compl, den_from_compl, den_to_compl});
     if constexpr (max_compl > 1) {
       if constexpr (den_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(DenFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<DenFrom>;
+        return convertible(
           dimensionless / (res.equation * ... * map_power(DensFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})) / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else if constexpr (num_to_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumTo{});
-        return min(res.result, convertible_impl(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                (res.equation * ... * map_power(NumsTo{})) /
-                                                  (map_power(DenTo{}) * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<NumTo>;
+        return min(res.result, convertible(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           (res.equation * ... * map_power(NumsTo{})) /
+                                             (map_power(DenTo{}) * ... * map_power(DensTo{}))));
       } else {
-        constexpr auto res = explode_to_equation(DenTo{});
-        return min(res.result, convertible_impl(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
-                                                  (res.equation * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<DenTo>;
+        return min(res.result, convertible(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
+                                             (res.equation * ... * map_power(DensTo{}))));
       }
     }
   }
@@ -1069,26 +1093,26 @@ template<typename NumFrom, typename... NumsFrom, typename NumTo, typename... Num
     return process_extracted<process_entities::to, extT>(num_from, den_from, type_list<NumsTo...>{},
                                                          type_list<DensTo...>{});
   else {
-    constexpr auto num_from_compl = get_complexity(NumFrom{});
-    constexpr auto num_to_compl = get_complexity(NumTo{});
-    constexpr auto den_to_compl = get_complexity(DenTo{});
+    constexpr auto num_from_compl = complexity<NumFrom>;
+    constexpr auto num_to_compl = complexity<NumTo>;
+    constexpr auto den_to_compl = complexity<DenTo>;
     constexpr auto max_compl = max({num_from_compl, num_to_compl, den_to_compl});
     if constexpr (max_compl > 1) {
       if constexpr (num_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<NumFrom>;
+        return convertible(
           (res.equation * ... * map_power(NumsFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})) / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else if constexpr (num_to_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
-                                                (res.equation * ... * map_power(NumsTo{})) /
-                                                  (map_power(DenTo{}) * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<NumTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
+                                           (res.equation * ... * map_power(NumsTo{})) /
+                                             (map_power(DenTo{}) * ... * map_power(DensTo{}))));
       } else {
-        constexpr auto res = explode_to_equation(DenTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
-                                                (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
-                                                  (res.equation * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<DenTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
+                                           (map_power(NumTo{}) * ... * map_power(NumsTo{})) /
+                                             (res.equation * ... * map_power(DensTo{}))));
       }
     }
   }
@@ -1109,26 +1133,26 @@ template<typename NumFrom, typename... NumsFrom, typename DenFrom, typename... D
     return process_extracted<process_entities::from, extF>(type_list<NumsFrom...>{}, type_list<DensFrom...>{}, num_to,
                                                            den_to);
   else {
-    constexpr auto num_from_compl = get_complexity(NumFrom{});
-    constexpr auto den_from_compl = get_complexity(DenFrom{});
-    constexpr auto den_to_compl = get_complexity(DenTo{});
+    constexpr auto num_from_compl = complexity<NumFrom>;
+    constexpr auto den_from_compl = complexity<DenFrom>;
+    constexpr auto den_to_compl = complexity<DenTo>;
     constexpr auto max_compl = max({num_from_compl, den_from_compl, den_to_compl});
     if constexpr (max_compl > 1) {
       if constexpr (num_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<NumFrom>;
+        return convertible(
           (res.equation * ... * map_power(NumsFrom{})) / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
           dimensionless / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else if constexpr (den_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(DenFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<DenFrom>;
+        return convertible(
           (map_power(NumFrom{}) * ... * map_power(NumsFrom{})) / (res.equation * ... * map_power(DensFrom{})),
           dimensionless / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else {
-        constexpr auto res = explode_to_equation(DenTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
-                                                  (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                dimensionless / (res.equation * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<DenTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
+                                             (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           dimensionless / (res.equation * ... * map_power(DensTo{}))));
       }
     }
   }
@@ -1149,26 +1173,26 @@ template<typename NumFrom, typename... NumsFrom, typename DenFrom, typename... D
     return process_extracted<process_entities::from, extF>(type_list<NumsFrom...>{}, type_list<DensFrom...>{}, num_to,
                                                            den_to);
   else {
-    constexpr auto num_from_compl = get_complexity(NumFrom{});
-    constexpr auto den_from_compl = get_complexity(DenFrom{});
-    constexpr auto num_to_compl = get_complexity(NumTo{});
+    constexpr auto num_from_compl = complexity<NumFrom>;
+    constexpr auto den_from_compl = complexity<DenFrom>;
+    constexpr auto num_to_compl = complexity<NumTo>;
     constexpr auto max_compl = max({num_from_compl, num_to_compl, den_from_compl});
     if constexpr (max_compl > 1) {
       if constexpr (num_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<NumFrom>;
+        return convertible(
           (res.equation * ... * map_power(NumsFrom{})) / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})));
       } else if constexpr (den_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(DenFrom{});
-        return convertible_impl(
+        constexpr auto res = exploded_equation<DenFrom>;
+        return convertible(
           (map_power(NumFrom{}) * ... * map_power(NumsFrom{})) / (res.equation * ... * map_power(DensFrom{})),
           (map_power(NumTo{}) * ... * map_power(NumsTo{})));
       } else {
-        constexpr auto res = explode_to_equation(NumTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
-                                                  (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                (res.equation * ... * map_power(NumsTo{}))));
+        constexpr auto res = exploded_equation<NumTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})) /
+                                             (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           (res.equation * ... * map_power(NumsTo{}))));
       }
     }
   }
@@ -1185,18 +1209,18 @@ template<typename NumFrom, typename... NumsFrom, typename NumTo, typename... Num
     return process_extracted<process_entities::numerators, ext>(type_list<NumsFrom...>{}, den_from,
                                                                 type_list<NumsTo...>{}, den_to);
   } else {
-    constexpr auto num_from_compl = get_complexity(NumFrom{});
-    constexpr auto num_to_compl = get_complexity(NumTo{});
+    constexpr auto num_from_compl = complexity<NumFrom>;
+    constexpr auto num_to_compl = complexity<NumTo>;
     constexpr auto max_compl = max(num_from_compl, num_to_compl);
     if constexpr (max_compl > 1) {
       if constexpr (num_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(NumFrom{});
-        return convertible_impl((res.equation * ... * map_power(NumsFrom{})),
-                                (map_power(NumTo{}) * ... * map_power(NumsTo{})));
+        constexpr auto res = exploded_equation<NumFrom>;
+        return convertible((res.equation * ... * map_power(NumsFrom{})),
+                           (map_power(NumTo{}) * ... * map_power(NumsTo{})));
       } else {
-        constexpr auto res = explode_to_equation(NumTo{});
-        return min(res.result, convertible_impl((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
-                                                (res.equation * ... * map_power(NumsTo{}))));
+        constexpr auto res = exploded_equation<NumTo>;
+        return min(res.result, convertible((map_power(NumFrom{}) * ... * map_power(NumsFrom{})),
+                                           (res.equation * ... * map_power(NumsTo{}))));
       }
     }
   }
@@ -1213,18 +1237,18 @@ template<typename DenFrom, typename... DensFrom, typename DenTo, typename... Den
     return process_extracted<process_entities::denominators, ext>(num_from, type_list<DensFrom...>{}, num_to,
                                                                   type_list<DensTo...>{});
   else {
-    constexpr auto den_from_compl = get_complexity(DenFrom{});
-    constexpr auto den_to_compl = get_complexity(DenTo{});
+    constexpr auto den_from_compl = complexity<DenFrom>;
+    constexpr auto den_to_compl = complexity<DenTo>;
     constexpr auto max_compl = max(den_from_compl, den_to_compl);
     if constexpr (max_compl > 1) {
       if constexpr (den_from_compl == max_compl) {
-        constexpr auto res = explode_to_equation(DenFrom{});
-        return convertible_impl(dimensionless / (res.equation * ... * map_power(DensFrom{})),
-                                dimensionless / (map_power(DenTo{}) * ... * map_power(DensTo{})));
+        constexpr auto res = exploded_equation<DenFrom>;
+        return convertible(dimensionless / (res.equation * ... * map_power(DensFrom{})),
+                           dimensionless / (map_power(DenTo{}) * ... * map_power(DensTo{})));
       } else {
-        constexpr auto res = explode_to_equation(DenTo{});
-        return min(res.result, convertible_impl(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
-                                                dimensionless / (res.equation * ... * map_power(DensTo{}))));
+        constexpr auto res = exploded_equation<DenTo>;
+        return min(res.result, convertible(dimensionless / (map_power(DenFrom{}) * ... * map_power(DensFrom{})),
+                                           dimensionless / (res.equation * ... * map_power(DensTo{}))));
       }
     }
   }
@@ -1333,22 +1357,20 @@ template<QuantitySpec From, QuantitySpec To>
   else if constexpr (From{} == To{})
     return yes;
   else if constexpr (QuantityKindSpec<From> || QuantityKindSpec<To>) {
-    constexpr auto from_kind = get_kind(From{});
-    constexpr auto to_kind = get_kind(To{});
+    using from_kind = std::remove_const_t<decltype(get_kind(From{}))>;
+    using to_kind = std::remove_const_t<decltype(get_kind(To{}))>;
     constexpr auto exploded_kind_result = [](specs_convertible_result res) {
       using enum specs_convertible_result;
       return res == no ? no : yes;
     };
-    if constexpr ((NamedQuantitySpec<std::remove_cvref_t<decltype(from_kind)>> &&
-                   NamedQuantitySpec<std::remove_cvref_t<decltype(to_kind)>>) ||
-                  get_complexity(from_kind) == get_complexity(to_kind))
-      return convertible_impl(from_kind, to_kind);
-    else if constexpr (get_complexity(from_kind) > get_complexity(to_kind))
-      return exploded_kind_result(
-        convertible_impl(get_kind(explode<get_complexity(to_kind)>(from_kind).quantity), to_kind));
+    if constexpr ((NamedQuantitySpec<from_kind> && NamedQuantitySpec<to_kind>) ||
+                  complexity<from_kind> == complexity<to_kind>)
+      return convertible(from_kind{}, to_kind{});
+    else if constexpr (complexity<from_kind> > complexity<to_kind>)
+      return exploded_kind_result(convertible(get_kind(exploded<complexity<to_kind>, from_kind>.quantity), to_kind{}));
     else
       return exploded_kind_result(
-        convertible_impl(from_kind, get_kind(explode<get_complexity(from_kind)>(to_kind).quantity)));
+        convertible(from_kind{}, get_kind(exploded<complexity<from_kind>, to_kind>.quantity)));
   } else if constexpr (NestedQuantityKindSpecOf<get_kind(To{}), from> && get_kind(To{}) == To{})
     return yes;
   else if constexpr (NamedQuantitySpec<From> && NamedQuantitySpec<To>) {
@@ -1359,31 +1381,31 @@ template<QuantitySpec From, QuantitySpec To>
         return std::derived_from<To, From> ? explicit_conversion : (get_kind(from) == get_kind(to) ? cast : no);
     } else if constexpr (get_kind(From{}) != get_kind(To{}))
       return no;
-    else if constexpr (get_complexity(From{}) != get_complexity(To{})) {
-      if constexpr (get_complexity(From{}) > get_complexity(To{}))
-        return convertible_impl(explode<get_complexity(to)>(from).quantity, to);
+    else if constexpr (complexity<From> != complexity<To>) {
+      if constexpr (complexity<From> > complexity<To>)
+        return convertible(exploded<complexity<To>, From>.quantity, to);
       else {
-        auto res = explode<get_complexity(from)>(to);
-        return min(res.result, convertible_impl(from, res.quantity));
+        constexpr auto res = exploded<complexity<From>, To>;
+        return min(res.result, convertible(from, res.quantity));
       }
     }
   } else if constexpr (IntermediateDerivedQuantitySpec<From> && IntermediateDerivedQuantitySpec<To>) {
     return are_ingredients_convertible(from, to);
   } else if constexpr (IntermediateDerivedQuantitySpec<From>) {
-    auto res = explode<get_complexity(to)>(from);
+    constexpr auto res = exploded<complexity<To>, From>;
     if constexpr (NamedQuantitySpec<std::remove_const_t<decltype(res.quantity)>>)
-      return convertible_impl(res.quantity, to);
+      return convertible(res.quantity, to);
     else if constexpr (requires { to._equation_; }) {
-      auto eq = explode_to_equation(to);
-      return min(eq.result, convertible_impl(res.quantity, eq.equation));
+      constexpr auto eq = exploded_equation<To>;
+      return min(eq.result, convertible(res.quantity, eq.equation));
     } else
       return are_ingredients_convertible(from, to);
   } else if constexpr (IntermediateDerivedQuantitySpec<To>) {
-    auto res = explode<get_complexity(from)>(to);
+    constexpr auto res = exploded<complexity<From>, To>;
     if constexpr (NamedQuantitySpec<std::remove_const_t<decltype(res.quantity)>>)
-      return min(res.result, convertible_impl(from, res.quantity));
+      return min(res.result, convertible(from, res.quantity));
     else if constexpr (requires { from._equation_; })
-      return min(res.result, convertible_impl(from._equation_, res.quantity));
+      return min(res.result, convertible(from._equation_, res.quantity));
     else
       return min(res.result, are_ingredients_convertible(from, to));
   }
@@ -1393,21 +1415,21 @@ template<QuantitySpec From, QuantitySpec To>
 }  // namespace detail
 
 template<QuantitySpec From, QuantitySpec To>
-[[nodiscard]] consteval bool implicitly_convertible(From from, To to)
+[[nodiscard]] consteval bool implicitly_convertible(From, To)
 {
-  return detail::convertible_impl(from, to) == detail::specs_convertible_result::yes;
+  return detail::convertible_result<From, To> == detail::specs_convertible_result::yes;
 }
 
 template<QuantitySpec From, QuantitySpec To>
-[[nodiscard]] consteval bool explicitly_convertible(From from, To to)
+[[nodiscard]] consteval bool explicitly_convertible(From, To)
 {
-  return detail::convertible_impl(from, to) >= detail::specs_convertible_result::explicit_conversion;
+  return detail::convertible_result<From, To> >= detail::specs_convertible_result::explicit_conversion;
 }
 
 template<QuantitySpec From, QuantitySpec To>
-[[nodiscard]] consteval bool castable(From from, To to)
+[[nodiscard]] consteval bool castable(From, To)
 {
-  return detail::convertible_impl(from, to) >= detail::specs_convertible_result::cast;
+  return detail::convertible_result<From, To> >= detail::specs_convertible_result::cast;
 }
 
 namespace detail {
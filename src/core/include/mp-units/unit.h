@@ -34,6 +34,7 @@
 #include <mp-units/bits/symbol_text.h>
 #include <mp-units/bits/text_tools.h>
 #include <mp-units/bits/unit_concepts.h>
+#include <mp-units/customization_points.h>
 #include <iterator>
 #include <string>
 
@@ -581,6 +582,27 @@ inline constexpr struct per_mille : named_unit<basic_symbol_text{"‰", "%o"}, m
   return detail::have_same_canonical_reference_unit(from, to);
 }
 
+/**
+ * @brief The factor that converts the numerical values expressed in `From` to the ones expressed in `To`
+ *
+ * The factor is computed at compile time and rounded once to `Rep`.  Integral representation types
+ * are supported only when the factor is an integer.
+ *
+ * @code{.cpp}
+ * static_assert(conversion_factor_v<si::kilo<si::metre>, si::metre, int> == 1000);
+ * @endcode
+ *
+ * @tparam From the unit of the source numerical values
+ * @tparam To the unit of the resulting numerical values
+ * @tparam Rep the type of the factor
+ */
+template<Unit auto From, Unit auto To, typename Rep = double>
+  requires(convertible(From, To)) &&
+          (treat_as_floating_point<Rep> ||
+           is_integral(detail::get_canonical_unit(From).mag / detail::get_canonical_unit(To).mag))
+inline constexpr Rep conversion_factor_v =
+  get_value<Rep>(detail::get_canonical_unit(From).mag / detail::get_canonical_unit(To).mag);
+
 // Common unit
 [[nodiscard]] consteval Unit auto common_unit(Unit auto u) { return u; }
 
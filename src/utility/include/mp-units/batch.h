@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/bits/external/type_traits.h>
+#include <mp-units/customization_points.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <cstddef>
+#include <ranges>
+
+namespace mp_units {
+
+namespace detail {
+
+template<typename From, typename To>
+struct batch_affine_transform;
+
+/**
+ * @brief An affine map between the numerical values of two quantity types
+ *
+ * Unit conversion of a quantity is a linear map of its numerical value, so it can be folded
+ * into a single multiplier computed at compile time.
+ */
+template<Quantity From, Quantity To>
+struct batch_affine_transform<From, To> {
+  using rep = MP_UNITS_TYPENAME To::rep;
+  static constexpr rep scale = quantity<To::reference, rep>(quantity<From::reference, rep>::one()).numerical_value_;
+  static constexpr rep offset = quantity_values<rep>::zero();
+};
+
+/**
+ * @brief An affine map between the numerical values of two quantity points
+ *
+ * Changing the origin and the unit of a quantity point is an affine map of its numerical value:
+ * the unit ratio provides the scale, and the image of the source origin provides the offset.
+ * Both are computed at compile time with the target representation type.
+ */
+template<QuantityPoint From, QuantityPoint To>
+struct batch_affine_transform<From, To> {
+  using rep = MP_UNITS_TYPENAME To::rep;
+  static constexpr rep scale = quantity<To::reference, rep>(quantity<From::reference, rep>::one()).numerical_value_;
+  static constexpr rep offset =
+    To(quantity_point<From::reference, From::point_origin, rep>::zero()).quantity_from_origin_.numerical_value_;
+};
+
+template<typename T>
+[[nodiscard]] constexpr auto& batch_numerical_value(T& v)
+{
+  if constexpr (QuantityPoint<std::remove_const_t<T>>)
+    return v.quantity_from_origin_.numerical_value_;
+  else
+    return v.numerical_value_;
+}
+
+template<typename From, typename To>
+constexpr void batch_transform(const From* first, std::size_t count, To* out)
+{
+  using transform = batch_affine_transform<From, To>;
+  using rep = MP_UNITS_TYPENAME transform::rep;
+  constexpr rep scale = transform::scale;
+  constexpr rep offset = transform::offset;
+  constexpr bool unit_scale = scale == quantity_values<rep>::one();
+  constexpr bool zero_offset = offset == quantity_values<rep>::zero();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto v = static_cast<rep>(batch_numerical_value(first[i]));
+    if constexpr (unit_scale && zero_offset)
+      batch_numerical_value(out[i]) = v;
+    else if constexpr (unit_scale)
+      batch_numerical_value(out[i]) = v + offset;
+    else if constexpr (zero_offset)
+      batch_numerical_value(out[i]) = v * scale;
+    else
+      batch_numerical_value(out[i]) = v * scale + offset;
+  }
+}
+
+template<typename R>
+using batch_value_t = std::ranges::range_value_t<std::remove_cvref_t<R>>;
+
+template<typename From, typename To>
+concept BatchTransformable =
+  std::ranges::contiguous_range<From> && std::ranges::sized_range<From> && std::ranges::contiguous_range<To> &&
+  std::ranges::sized_range<To> && std::ranges::output_range<To, batch_value_t<To>>;
+
+}  // namespace detail
+
+/**
+ * @brief Re-expresses a contiguous range of quantity points relative to a new origin
+ *
+ * Produces the same values as calling `qp.point_for(NewPO)` for every element and converting the result
+ * to the element type of `to`. The origin offset and the unit scale are folded at compile time into
+ * a single affine transform, so every element costs at most one multiply and one add.
+ *
+ * @code{.cpp}
+ * std::vector<quantity_point<si::degree_Celsius, si::ice_point>> celsius = ...;
+ * std::vector<quantity_point<si::kelvin, si::absolute_zero>> kelvin(celsius.size());
+ * point_for<si::absolute_zero>(celsius, kelvin);
+ * @endcode
+ *
+ * @note `to` must have at least as many elements as `from`.
+ *
+ * @tparam NewPO the point origin of the resulting quantity points
+ * @param from quantity points to convert
+ * @param to storage for the converted quantity points
+ */
+template<PointOrigin auto NewPO, typename From, typename To>
+  requires detail::BatchTransformable<From, To> && QuantityPoint<detail::batch_value_t<From>> &&
+           QuantityPoint<detail::batch_value_t<To>> &&
+           is_same_v<std::remove_const_t<decltype(detail::batch_value_t<To>::point_origin)>,
+                     std::remove_const_t<decltype(NewPO)>> &&
+           std::convertible_to<decltype(std::declval<detail::batch_value_t<From>>().point_for(NewPO)),
+                               detail::batch_value_t<To>>
+constexpr void point_for(const From& from, To&& to)
+{
+  gsl_Expects(std::ranges::size(to) >= std::ranges::size(from));
+  detail::batch_transform(std::ranges::data(from), std::ranges::size(from), std::ranges::data(to));
+}
+
+/**
+ * @brief Converts a contiguous range of quantities or quantity points to a new unit
+ *
+ * Produces the same values as calling `.in(U)` for every element and converting the result to the element
+ * type of `to`. The unit scale is computed at compile time so every element costs at most one multiply.
+ * Quantity points keep their point origin.
+ *
+ * @note `to` must have at least as many elements as `from`.
+ *
+ * @tparam U the unit of the resulting quantities or quantity points
+ * @param from quantities or quantity points to convert
+ * @param to storage for the converted values
+ */
+template<Unit auto U, typename From, typename To>
+  requires detail::BatchTransformable<From, To> && (detail::batch_value_t<To>::unit == U) &&
+           ((Quantity<detail::batch_value_t<From>> && Quantity<detail::batch_value_t<To>>) ||
+            (QuantityPoint<detail::batch_value_t<From>> && QuantityPoint<detail::batch_value_t<To>> &&
+             is_same_v<std::remove_const_t<decltype(detail::batch_value_t<From>::point_origin)>,
+                       std::remove_const_t<decltype(detail::batch_value_t<To>::point_origin)>>)) &&
+           std::convertible_to<decltype(std::declval<detail::batch_value_t<From>>().in(U)), detail::batch_value_t<To>>
+constexpr void in(const From& from, To&& to)
+{
+  gsl_Expects(std::ranges::size(to) >= std::ranges::size(from));
+  detail::batch_transform(std::ranges::data(from), std::ranges::size(from), std::ranges::data(to));
+}
+
+}  // namespace mp_units
@@ -0,0 +1,194 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/chrono.h>
+#include <mp-units/histogram.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/prefixes.h>
+#include <mp-units/systems/si/units.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#if defined __x86_64__ || defined __i386__ || defined _M_X64 || defined _M_IX86
+#define MP_UNITS_HAS_TSC 1
+#if MP_UNITS_COMP_MSVC
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define MP_UNITS_HAS_TSC 0
+#endif
+
+namespace mp_units {
+
+/**
+ * @brief A `std::chrono`-compatible clock reading the CPU time-stamp counter
+ *
+ * The counter frequency is calibrated once against `std::chrono::steady_clock` on the first use
+ * of the clock. Calling `tsc_clock::frequency()` during the program startup moves this cost out
+ * of the hot path.
+ *
+ * @note The clock assumes an invariant time-stamp counter (constant rate and synchronized between
+ * cores) which is the case for all x86 processors manufactured in the last decade. On other
+ * architectures the clock falls back to `std::chrono::steady_clock`.
+ */
+struct tsc_clock {
+  using rep = std::int64_t;
+  using period = std::nano;
+  using duration = std::chrono::duration<rep, period>;
+  using time_point = std::chrono::time_point<tsc_clock>;
+  static constexpr bool is_steady = true;
+
+  [[nodiscard]] static std::uint64_t ticks() noexcept
+  {
+#if MP_UNITS_HAS_TSC
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+  }
+
+  [[nodiscard]] static quantity<isq::frequency[si::hertz]> frequency() noexcept
+  {
+    return 1e9 / calibration().ns_per_tick * isq::frequency[si::hertz];
+  }
+
+  [[nodiscard]] static time_point now() noexcept
+  {
+    const calibration_data& c = calibration();
+    // the counter of another core may lag slightly behind the calibrating one which would wrap the unsigned difference
+    const auto ticks_since_base = std::max(static_cast<std::int64_t>(ticks() - c.base_ticks), std::int64_t{0});
+    const auto elapsed = static_cast<double>(ticks_since_base) * c.ns_per_tick;
+    return time_point(duration(static_cast<rep>(elapsed)));
+  }
+
+private:
+  struct calibration_data {
+    std::uint64_t base_ticks;
+    double ns_per_tick;
+  };
+
+  [[nodiscard]] static const calibration_data& calibration() noexcept
+  {
+    static const calibration_data data = [] {
+#if MP_UNITS_HAS_TSC
+      using namespace std::chrono;
+      constexpr auto window = milliseconds(10);
+      const auto t0 = steady_clock::now();
+      const std::uint64_t c0 = ticks();
+      auto t1 = t0;
+      while (t1 - t0 < window) t1 = steady_clock::now();
+      const std::uint64_t c1 = ticks();
+      const auto ns = duration_cast<nanoseconds>(t1 - t0).count();
+      return calibration_data{c1, static_cast<double>(ns) / static_cast<double>(c1 - c0)};
+#else
+      return calibration_data{ticks(), 1.};
+#endif
+    }();
+    return data;
+  }
+};
+
+/**
+ * @brief A clock facade returning quantity points
+ *
+ * Reads the underlying `std::chrono`-compatible clock and returns its time as an integral number
+ * of nanoseconds measured from `chrono_point_origin<Clock>`, so the result may be converted back
+ * with `to_chrono_time_point()`.
+ *
+ * @code{.cpp}
+ * const auto start = quantity_clock<tsc_clock>::now();
+ * // ...
+ * const quantity<isq::time[si::nano<si::second>], std::int64_t> elapsed = quantity_clock<tsc_clock>::now() - start;
+ * @endcode
+ *
+ * @tparam Clock a `std::chrono`-compatible clock
+ */
+template<typename Clock = std::chrono::steady_clock>
+struct quantity_clock {
+  using clock = Clock;
+  using rep = std::int64_t;
+  static constexpr Reference auto reference = isq::time[si::nano<si::second>];
+  static constexpr PointOrigin auto point_origin = chrono_point_origin<Clock>;
+  using duration = quantity<reference, rep>;
+  using time_point = quantity_point<reference, point_origin, rep>;
+  static constexpr bool is_steady = Clock::is_steady;
+
+  [[nodiscard]] static time_point now() noexcept(noexcept(Clock::now()))
+  {
+    const auto d = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch());
+    return point_origin + static_cast<rep>(d.count()) * reference;
+  }
+};
+
+/**
+ * @brief Records the lifetime of a scope
+ *
+ * Reads the clock on construction and records the elapsed time into the provided recorder
+ * (by default `quantity_histogram`) on destruction.
+ *
+ * @code{.cpp}
+ * thread_local quantity_histogram<quantity_clock<>::duration> latency;
+ *
+ * void process()
+ * {
+ *   scoped_timer timer(latency);
+ *   // ...
+ * }
+ * @endcode
+ *
+ * @tparam Clock a clock providing quantity points (e.g. `quantity_clock`)
+ * @tparam Recorder a type providing `record(Clock::duration)` member function
+ */
+template<typename Clock = quantity_clock<>, typename Recorder = quantity_histogram<typename Clock::duration>>
+  requires requires(Recorder& r, typename Clock::duration d) { r.record(d); }
+class scoped_timer {
+public:
+  using clock = Clock;
+  using duration = MP_UNITS_TYPENAME Clock::duration;
+  using time_point = MP_UNITS_TYPENAME Clock::time_point;
+
+  explicit scoped_timer(Recorder& recorder) noexcept(noexcept(Clock::now())) :
+      recorder_(recorder), start_(Clock::now())
+  {
+  }
+
+  scoped_timer(const scoped_timer&) = delete;
+  scoped_timer& operator=(const scoped_timer&) = delete;
+
+  ~scoped_timer() { recorder_.record(elapsed()); }
+
+  [[nodiscard]] duration elapsed() const noexcept(noexcept(Clock::now())) { return Clock::now() - start_; }
+
+private:
+  Recorder& recorder_;
+  time_point start_;
+};
+
+}  // namespace mp_units
@@ -0,0 +1,70 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/unit.h>
+#include <array>
+#include <cstddef>
+#include <string>
+
+namespace mp_units {
+
+/**
+ * @brief A static table of the conversion factors between all the pairs of the provided units
+ *
+ * `factors[i][j]` converts the numerical values expressed in the `i`-th unit to the `j`-th one and is
+ * `0` when the units are not convertible.  The table is computed at compile time and is meant to be
+ * exported to the environments doing the conversions as plain multiplications (e.g. databases).
+ *
+ * @tparam Rep the type of the factors
+ * @tparam Us the units of the table
+ */
+template<typename Rep, Unit auto... Us>
+class conversion_table {
+  template<Unit auto From, Unit auto To>
+  [[nodiscard]] static consteval Rep factor()
+  {
+    if constexpr (requires { conversion_factor_v<From, To, Rep>; })
+      return conversion_factor_v<From, To, Rep>;
+    else
+      return Rep{0};
+  }
+
+  template<Unit auto From>
+  [[nodiscard]] static consteval std::array<Rep, sizeof...(Us)> row()
+  {
+    return {factor<From, Us>()...};
+  }
+
+public:
+  static constexpr std::size_t size = sizeof...(Us);
+
+  static constexpr std::array<std::array<Rep, size>, size> factors = {row<Us>()...};
+
+  [[nodiscard]] static constexpr std::array<std::string, size> symbols(unit_symbol_formatting fmt = {})
+  {
+    return {unit_symbol(Us, fmt)...};
+  }
+};
+
+}  // namespace mp_units
@@ -0,0 +1,249 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/customization_points.h>
+
+// IWYU pragma: begin_exports
+#include <cstddef>
+#include <cstdint>
+// IWYU pragma: end_exports
+
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace mp_units {
+
+/**
+ * @brief A binary fixed-point number to be used as a representation type on targets without an FPU
+ *
+ * The value is stored as an integer scaled by `2^FracBits`, so `fixed_point<std::int32_t, 16>` is
+ * the Q15.16 format. All the arithmetic is done with integer instructions. The products and the
+ * quotients are computed in `std::intmax_t` and truncated towards zero.
+ *
+ * The shift operators scale the value by powers of 2, which allows `sudo_cast` to convert between
+ * units related by binary prefixes without any multiplication or division.
+ *
+ * @tparam Int the underlying integral type
+ * @tparam FracBits the number of fractional bits
+ */
+template<std::integral Int, std::size_t FracBits>
+  requires(!std::same_as<Int, bool>) && (sizeof(Int) < sizeof(std::intmax_t)) &&
+          (FracBits < static_cast<std::size_t>(std::numeric_limits<Int>::digits))
+class fixed_point {
+  using wide = std::conditional_t<std::is_signed_v<Int>, std::intmax_t, std::uintmax_t>;
+  static constexpr wide scale = wide{1} << FracBits;
+
+  Int raw_{};
+
+  // divides by `2^n` with a truncation towards zero like the integral division does
+  [[nodiscard]] static constexpr wide shift_right(wide v, std::size_t n)
+  {
+    if constexpr (std::is_signed_v<Int>) {
+      if (v < 0) return -(-v >> n);
+    }
+    return v >> n;
+  }
+
+  [[nodiscard]] static constexpr fixed_point from_wide(wide v) { return from_raw(static_cast<Int>(v)); }
+
+public:
+  using raw_type = Int;
+  // the values are scaled by integers rather than converted to a common type with `std::intmax_t` which could not
+  // hold most of its values
+  using value_type = Int;
+  static constexpr std::size_t fractional_bits = FracBits;
+
+  fixed_point() = default;
+
+  template<std::integral I>
+  constexpr fixed_point(I v) : raw_(static_cast<Int>(static_cast<wide>(v) * scale))
+  {
+  }
+
+  // rounds to the nearest representable value
+  template<std::floating_point F>
+  constexpr explicit fixed_point(F v) :
+      raw_(static_cast<Int>(v * static_cast<F>(scale) + (v < F{0} ? F{-0.5} : F{0.5})))
+  {
+  }
+
+  template<std::integral Int2, std::size_t FracBits2>
+    requires(!std::same_as<fixed_point<Int2, FracBits2>, fixed_point>)
+  constexpr explicit fixed_point(fixed_point<Int2, FracBits2> v)
+  {
+    if constexpr (FracBits >= FracBits2)
+      raw_ = static_cast<Int>(static_cast<wide>(v.raw()) * (wide{1} << (FracBits - FracBits2)));
+    else
+      raw_ = static_cast<Int>(shift_right(static_cast<wide>(v.raw()), FracBits2 - FracBits));
+  }
+
+  [[nodiscard]] static constexpr fixed_point from_raw(Int raw) noexcept
+  {
+    fixed_point res;
+    res.raw_ = raw;
+    return res;
+  }
+
+  [[nodiscard]] constexpr Int raw() const noexcept { return raw_; }
+
+  // truncates towards zero
+  template<std::integral I>
+  [[nodiscard]] constexpr explicit operator I() const
+  {
+    return static_cast<I>(static_cast<wide>(raw_) / scale);
+  }
+
+  template<std::floating_point F>
+  [[nodiscard]] constexpr explicit operator F() const
+  {
+    return static_cast<F>(raw_) / static_cast<F>(scale);
+  }
+
+  [[nodiscard]] constexpr fixed_point operator+() const { return *this; }
+  [[nodiscard]] constexpr fixed_point operator-() const { return from_wide(-static_cast<wide>(raw_)); }
+
+  constexpr fixed_point& operator+=(fixed_point v)
+  {
+    raw_ = static_cast<Int>(raw_ + v.raw_);
+    return *this;
+  }
+
+  constexpr fixed_point& operator-=(fixed_point v)
+  {
+    raw_ = static_cast<Int>(raw_ - v.raw_);
+    return *this;
+  }
+
+  constexpr fixed_point& operator*=(fixed_point v)
+  {
+    return *this = from_wide(shift_right(static_cast<wide>(raw_) * v.raw_, FracBits));
+  }
+
+  constexpr fixed_point& operator/=(fixed_point v)
+  {
+    return *this = from_wide(static_cast<wide>(raw_) * scale / v.raw_);
+  }
+
+  // the integral overloads do not need to rescale the product and the quotient
+  template<std::integral I>
+  constexpr fixed_point& operator*=(I v)
+  {
+    return *this = from_wide(static_cast<wide>(raw_) * static_cast<wide>(v));
+  }
+
+  template<std::integral I>
+  constexpr fixed_point& operator/=(I v)
+  {
+    return *this = from_wide(static_cast<wide>(raw_) / static_cast<wide>(v));
+  }
+
+  constexpr fixed_point& operator<<=(int n)
+  {
+    raw_ = static_cast<Int>(static_cast<std::make_unsigned_t<wide>>(raw_) << n);
+    return *this;
+  }
+
+  constexpr fixed_point& operator>>=(int n)
+  {
+    raw_ = static_cast<Int>(shift_right(raw_, static_cast<std::size_t>(n)));
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator+(fixed_point lhs, fixed_point rhs) { return lhs += rhs; }
+  [[nodiscard]] friend constexpr fixed_point operator-(fixed_point lhs, fixed_point rhs) { return lhs -= rhs; }
+  [[nodiscard]] friend constexpr fixed_point operator*(fixed_point lhs, fixed_point rhs) { return lhs *= rhs; }
+  [[nodiscard]] friend constexpr fixed_point operator/(fixed_point lhs, fixed_point rhs) { return lhs /= rhs; }
+
+  template<std::integral I>
+  [[nodiscard]] friend constexpr fixed_point operator*(fixed_point lhs, I rhs)
+  {
+    return lhs *= rhs;
+  }
+
+  template<std::integral I>
+  [[nodiscard]] friend constexpr fixed_point operator*(I lhs, fixed_point rhs)
+  {
+    return rhs *= lhs;
+  }
+
+  template<std::integral I>
+  [[nodiscard]] friend constexpr fixed_point operator/(fixed_point lhs, I rhs)
+  {
+    return lhs /= rhs;
+  }
+
+  [[nodiscard]] friend constexpr fixed_point operator<<(fixed_point lhs, int n) { return lhs <<= n; }
+  [[nodiscard]] friend constexpr fixed_point operator>>(fixed_point lhs, int n) { return lhs >>= n; }
+
+  [[nodiscard]] friend constexpr bool operator==(fixed_point, fixed_point) = default;
+  [[nodiscard]] friend constexpr auto operator<=>(fixed_point, fixed_point) = default;
+
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, fixed_point v)
+  {
+    return os << static_cast<double>(v);
+  }
+};
+
+template<typename Int, std::size_t FracBits>
+inline constexpr bool is_scalar<fixed_point<Int, FracBits>> = true;
+
+// a conversion to a coarser unit may lose the fractional bits so it has to be explicit (a conversion to a finer
+// unit may overflow like for integers); this also makes `sudo_cast` scale the values with integral factors
+template<typename Int, std::size_t FracBits>
+inline constexpr bool treat_as_floating_point<fixed_point<Int, FracBits>> = false;
+
+template<typename Int, std::size_t FracBits>
+struct quantity_values<fixed_point<Int, FracBits>> {
+  using rep = fixed_point<Int, FracBits>;
+  static constexpr rep zero() noexcept { return rep{}; }
+  static constexpr rep one() noexcept { return rep{1}; }
+  static constexpr rep min() noexcept { return rep::from_raw(std::numeric_limits<Int>::lowest()); }
+  static constexpr rep max() noexcept { return rep::from_raw(std::numeric_limits<Int>::max()); }
+};
+
+}  // namespace mp_units
+
+// only the integers not wider than the integral part of a fixed-point number have a common type with it
+template<typename Int, std::size_t FracBits, std::integral I>
+struct std::common_type<mp_units::fixed_point<Int, FracBits>, I> {};
+
+template<std::integral I, typename Int, std::size_t FracBits>
+struct std::common_type<I, mp_units::fixed_point<Int, FracBits>> {};
+
+template<typename Int, std::size_t FracBits, std::integral I>
+  requires(std::numeric_limits<I>::digits <= std::numeric_limits<Int>::digits - static_cast<int>(FracBits))
+struct std::common_type<mp_units::fixed_point<Int, FracBits>, I> {
+  using type = mp_units::fixed_point<Int, FracBits>;
+};
+
+template<std::integral I, typename Int, std::size_t FracBits>
+  requires(std::numeric_limits<I>::digits <= std::numeric_limits<Int>::digits - static_cast<int>(FracBits))
+struct std::common_type<I, mp_units::fixed_point<Int, FracBits>> {
+  using type = mp_units::fixed_point<Int, FracBits>;
+};
@@ -0,0 +1,296 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/customization_points.h>
+
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace mp_units {
+
+namespace detail {
+
+/**
+ * @brief A portable 16-bit floating-point storage type
+ *
+ * Used when the compiler does not provide `std::float16_t` or `std::bfloat16_t`. The values are
+ * converted from `double` with a single rounding to the nearest even value and all the arithmetic
+ * promotes to `float`, as it does for the standard extended floating-point types.
+ *
+ * @tparam ExpBits the number of bits of the exponent
+ * @tparam MantBits the number of explicitly stored bits of the significand
+ */
+template<int ExpBits, int MantBits>
+  requires(1 + ExpBits + MantBits == 16) && (ExpBits <= 8)
+class float16_storage {
+  static constexpr int bias = (1 << (ExpBits - 1)) - 1;
+  static constexpr std::uint16_t exp_mask = ((1u << ExpBits) - 1u) << MantBits;
+  static constexpr std::uint16_t sign_mask = 0x8000;
+
+  std::uint16_t bits_{};
+
+  [[nodiscard]] static constexpr std::uint64_t round_to_nearest_even(std::uint64_t v, int shift)
+  {
+    if (shift >= 64) return 0;
+    const std::uint64_t res = v >> shift;
+    const std::uint64_t rem = v & ((std::uint64_t{1} << shift) - 1);
+    const std::uint64_t half = std::uint64_t{1} << (shift - 1);
+    return res + ((rem > half || (rem == half && (res & 1) != 0)) ? 1 : 0);
+  }
+
+  [[nodiscard]] static constexpr std::uint16_t encode(double v)
+  {
+    const auto bits = std::bit_cast<std::uint64_t>(v);
+    const auto sign = static_cast<std::uint16_t>((bits >> 48) & sign_mask);
+    const auto exp = static_cast<int>((bits >> 52) & 0x7FF);
+    const std::uint64_t mant = bits & ((std::uint64_t{1} << 52) - 1);
+
+    if (exp == 0x7FF)  // infinity or NaN (quiet)
+      return static_cast<std::uint16_t>(sign | exp_mask | (mant != 0 ? 1u << (MantBits - 1) : 0u));
+    if (exp == 0)  // the subnormal doubles are below the smallest subnormal of any 16-bit format
+      return sign;
+
+    const int target_exp = exp - 1023 + bias;
+    if (target_exp >= (1 << ExpBits) - 1) return static_cast<std::uint16_t>(sign | exp_mask);
+
+    const std::uint64_t significand = mant | (std::uint64_t{1} << 52);
+    if (target_exp <= 0)
+      // a carry out of the rounded subnormal yields the smallest normal value
+      return static_cast<std::uint16_t>(sign | round_to_nearest_even(significand, 52 - MantBits + 1 - target_exp));
+
+    // a carry out of the rounded significand increments the exponent (up to the infinity)
+    const std::uint64_t rounded = round_to_nearest_even(significand, 52 - MantBits);
+    return static_cast<std::uint16_t>(
+      sign | ((static_cast<std::uint64_t>(target_exp) << MantBits) + rounded - (std::uint64_t{1} << MantBits)));
+  }
+
+  [[nodiscard]] static constexpr float decode(std::uint16_t bits)
+  {
+    const auto sign = static_cast<std::uint32_t>(bits & sign_mask) << 16;
+    const int exp = (bits & exp_mask) >> MantBits;
+    const std::uint32_t mant = bits & ((1u << MantBits) - 1u);
+
+    if (exp == (1 << ExpBits) - 1)
+      return std::bit_cast<float>(sign | 0x7F80'0000u | (mant << (23 - MantBits)));
+    if (exp == 0) {
+      // subnormal; exactly representable in `float`
+      float res = static_cast<float>(mant);
+      for (int i = 0; i < bias - 1 + MantBits; ++i) res *= 0.5f;
+      return sign != 0 ? -res : res;
+    }
+    return std::bit_cast<float>(sign | (static_cast<std::uint32_t>(exp - bias + 127) << 23) |
+                                (mant << (23 - MantBits)));
+  }
+
+public:
+  float16_storage() = default;
+
+  // like for the standard extended floating-point types, only the integral values convert implicitly
+  template<std::integral T>
+  constexpr float16_storage(T v) : bits_(encode(static_cast<double>(v)))
+  {
+  }
+
+  template<std::floating_point T>
+  constexpr explicit float16_storage(T v) : bits_(encode(static_cast<double>(v)))
+  {
+  }
+
+  template<int ExpBits2, int MantBits2>
+    requires(ExpBits2 != ExpBits)
+  constexpr explicit float16_storage(float16_storage<ExpBits2, MantBits2> v) : bits_(encode(static_cast<float>(v)))
+  {
+  }
+
+  [[nodiscard]] static constexpr float16_storage from_bits(std::uint16_t bits) noexcept
+  {
+    float16_storage res;
+    res.bits_ = bits;
+    return res;
+  }
+
+  [[nodiscard]] constexpr std::uint16_t bits() const noexcept { return bits_; }
+
+  [[nodiscard]] constexpr operator float() const { return decode(bits_); }
+
+  [[nodiscard]] constexpr float16_storage operator+() const { return *this; }
+  [[nodiscard]] constexpr float16_storage operator-() const { return from_bits(bits_ ^ sign_mask); }
+
+  [[nodiscard]] friend constexpr float operator+(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) + float(rhs);
+  }
+  [[nodiscard]] friend constexpr float operator-(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) - float(rhs);
+  }
+  [[nodiscard]] friend constexpr float operator*(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) * float(rhs);
+  }
+  [[nodiscard]] friend constexpr float operator/(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) / float(rhs);
+  }
+
+  template<typename T>
+    requires requires(float f, T v) { f += v; }
+  constexpr float16_storage& operator+=(const T& v)
+  {
+    return *this = float16_storage(float(*this) + v);
+  }
+
+  template<typename T>
+    requires requires(float f, T v) { f -= v; }
+  constexpr float16_storage& operator-=(const T& v)
+  {
+    return *this = float16_storage(float(*this) - v);
+  }
+
+  template<typename T>
+    requires requires(float f, T v) { f *= v; }
+  constexpr float16_storage& operator*=(const T& v)
+  {
+    return *this = float16_storage(float(*this) * v);
+  }
+
+  template<typename T>
+    requires requires(float f, T v) { f /= v; }
+  constexpr float16_storage& operator/=(const T& v)
+  {
+    return *this = float16_storage(float(*this) / v);
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) == float(rhs);
+  }
+
+  [[nodiscard]] friend constexpr std::partial_ordering operator<=>(float16_storage lhs, float16_storage rhs)
+  {
+    return float(lhs) <=> float(rhs);
+  }
+
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, float16_storage v)
+  {
+    return os << float(v);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief IEEE 754 binary16 floating-point type
+ *
+ * `std::float16_t` if provided by the implementation, otherwise a portable storage type which
+ * promotes to `float` for the arithmetic.
+ */
+#if defined(__STDCPP_FLOAT16_T__)
+using float16 = std::float16_t;
+#else
+using float16 = detail::float16_storage<5, 10>;
+#endif
+
+/**
+ * @brief The "brain" floating-point type with the range of `float` and 8 bits of precision
+ *
+ * `std::bfloat16_t` if provided by the implementation, otherwise a portable storage type which
+ * promotes to `float` for the arithmetic.
+ */
+#if defined(__STDCPP_BFLOAT16_T__)
+using bfloat16 = std::bfloat16_t;
+#else
+using bfloat16 = detail::float16_storage<8, 7>;
+#endif
+
+template<int ExpBits, int MantBits>
+inline constexpr bool is_scalar<detail::float16_storage<ExpBits, MantBits>> = true;
+
+template<int ExpBits, int MantBits>
+inline constexpr bool treat_as_floating_point<detail::float16_storage<ExpBits, MantBits>> = true;
+
+}  // namespace mp_units
+
+template<int ExpBits, int MantBits>
+class std::numeric_limits<mp_units::detail::float16_storage<ExpBits, MantBits>> {
+  using type = mp_units::detail::float16_storage<ExpBits, MantBits>;
+  static constexpr std::uint16_t exp_mask = ((1u << ExpBits) - 1u) << MantBits;
+public:
+  static constexpr bool is_specialized = true;
+  static constexpr bool is_signed = true;
+  static constexpr bool is_integer = false;
+  static constexpr bool is_exact = false;
+  static constexpr bool has_infinity = true;
+  static constexpr bool has_quiet_NaN = true;
+  static constexpr bool is_iec559 = ExpBits == 5;
+  static constexpr bool is_bounded = true;
+  static constexpr int radix = 2;
+  static constexpr int digits = MantBits + 1;
+  static constexpr int max_exponent = 1 << (ExpBits - 1);
+  static constexpr int min_exponent = 3 - max_exponent;
+  static constexpr std::float_round_style round_style = std::round_to_nearest;
+
+  static constexpr type min() noexcept { return type::from_bits(1u << MantBits); }
+  static constexpr type max() noexcept { return type::from_bits(static_cast<std::uint16_t>(exp_mask - 1u)); }
+  static constexpr type lowest() noexcept
+  {
+    return type::from_bits(static_cast<std::uint16_t>(0x8000u | (exp_mask - 1u)));
+  }
+  static constexpr type epsilon() noexcept
+  {
+    return type::from_bits(static_cast<std::uint16_t>((max_exponent - 1 - MantBits) << MantBits));
+  }
+  static constexpr type infinity() noexcept { return type::from_bits(exp_mask); }
+  static constexpr type quiet_NaN() noexcept
+  {
+    return type::from_bits(static_cast<std::uint16_t>(exp_mask | (1u << (MantBits - 1))));
+  }
+  static constexpr type denorm_min() noexcept { return type::from_bits(1); }
+};
+
+// the arithmetic promotes to `float` (or a wider type)
+template<int ExpBits, int MantBits, typename T>
+  requires std::is_arithmetic_v<T>
+struct std::common_type<mp_units::detail::float16_storage<ExpBits, MantBits>, T> : std::common_type<float, T> {};
+
+template<typename T, int ExpBits, int MantBits>
+  requires std::is_arithmetic_v<T>
+struct std::common_type<T, mp_units::detail::float16_storage<ExpBits, MantBits>> : std::common_type<T, float> {};
+
+// like `std::float16_t` and `std::bfloat16_t`, `float16` and `bfloat16` do not have a common type
+// (the built-in conversions to `float` would otherwise make it `float`)
+template<int E1, int M1, int E2, int M2>
+  requires(E1 != E2)
+struct std::common_type<mp_units::detail::float16_storage<E1, M1>, mp_units::detail::float16_storage<E2, M2>> {};
@@ -0,0 +1,238 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/quantity.h>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace mp_units {
+
+namespace detail {
+
+/**
+ * @brief Log-linear bucket layout of a histogram
+ *
+ * Values below `2^PrecisionBits` get their own bucket. Every following power-of-two range
+ * is split into `2^(PrecisionBits - 1)` equal buckets, so a bucket is never wider than
+ * `2^-(PrecisionBits - 1)` of its lower bound. The bucket of a value is found with one
+ * `std::bit_width`, one shift, and one add.
+ */
+template<std::integral Rep, std::size_t PrecisionBits>
+struct log_linear_buckets {
+  using unsigned_rep = std::make_unsigned_t<Rep>;
+  static constexpr std::size_t value_bits = static_cast<std::size_t>(std::numeric_limits<Rep>::digits);
+  static_assert(PrecisionBits > 0 && PrecisionBits < value_bits);
+
+  static constexpr std::size_t half_sub_bucket_count = std::size_t{1} << (PrecisionBits - 1);
+  static constexpr std::size_t count = (value_bits - PrecisionBits + 2) * half_sub_bucket_count;
+
+  [[nodiscard]] static constexpr std::size_t index(Rep v) noexcept
+  {
+    const auto u = static_cast<unsigned_rep>(v);
+    const auto width = static_cast<std::size_t>(std::bit_width(u));
+    const std::size_t shift = width > PrecisionBits ? width - PrecisionBits : 0;
+    return (shift << (PrecisionBits - 1)) + static_cast<std::size_t>(u >> shift);
+  }
+
+  [[nodiscard]] static constexpr std::size_t shift(std::size_t index) noexcept
+  {
+    return index < 2 * half_sub_bucket_count ? 0 : (index >> (PrecisionBits - 1)) - 1;
+  }
+
+  [[nodiscard]] static constexpr Rep lower_bound(std::size_t index) noexcept
+  {
+    const std::size_t s = shift(index);
+    return static_cast<Rep>(static_cast<unsigned_rep>(index - (s << (PrecisionBits - 1))) << s);
+  }
+
+  [[nodiscard]] static constexpr Rep upper_bound(std::size_t index) noexcept
+  {
+    return static_cast<Rep>(static_cast<unsigned_rep>(lower_bound(index)) +
+                            ((unsigned_rep{1} << shift(index)) - unsigned_rep{1}));
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief A non-atomic copy of the counters of `quantity_histogram`
+ *
+ * Snapshots taken from many histograms (e.g. per-thread ones) may be merged together
+ * and queried for percentiles.
+ *
+ * @tparam Q a quantity type with an integral representation type
+ * @tparam PrecisionBits the number of significant bits kept for each recorded value
+ */
+template<Quantity Q, std::size_t PrecisionBits = 7>
+  requires std::integral<typename Q::rep>
+class quantity_histogram_snapshot {
+  using buckets = detail::log_linear_buckets<typename Q::rep, PrecisionBits>;
+public:
+  using quantity_type = Q;
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  using count_type = std::uint64_t;
+  static constexpr std::size_t bucket_count = buckets::count;
+
+  std::array<count_type, bucket_count> counts{};
+
+  [[nodiscard]] constexpr count_type count() const noexcept
+  {
+    count_type total = 0;
+    for (const count_type c : counts) total += c;
+    return total;
+  }
+
+  /**
+   * @brief Returns the value below or at which the given percentage of recorded values falls
+   *
+   * The result is the upper bound of the bucket holding the requested rank, so it never
+   * underestimates the real percentile by more than the bucket precision.
+   *
+   * @param p percentile in the range [0, 100]
+   */
+  [[nodiscard]] constexpr quantity_type percentile(double p) const noexcept
+  {
+    gsl_Expects(p >= 0. && p <= 100.);
+    const count_type total = count();
+    if (total == 0) return make_quantity<quantity_type::reference>(rep{0});
+    const double exact_rank = p / 100. * static_cast<double>(total);
+    auto rank = static_cast<count_type>(exact_rank);
+    if (rank == 0 || static_cast<double>(rank) < exact_rank) ++rank;
+    count_type cumulative = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      cumulative += counts[i];
+      if (cumulative >= rank) return make_quantity<quantity_type::reference>(buckets::upper_bound(i));
+    }
+    return make_quantity<quantity_type::reference>(buckets::upper_bound(bucket_count - 1));
+  }
+
+  constexpr quantity_histogram_snapshot& operator+=(const quantity_histogram_snapshot& other) noexcept
+  {
+    for (std::size_t i = 0; i < bucket_count; ++i) counts[i] += other.counts[i];
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr quantity_histogram_snapshot operator+(quantity_histogram_snapshot lhs,
+                                                                       const quantity_histogram_snapshot& rhs) noexcept
+  {
+    return lhs += rhs;
+  }
+};
+
+/**
+ * @brief A lock-free histogram of quantity values with a log-linear bucket layout
+ *
+ * Similarly to HDR Histogram, values are stored with a bounded relative error of at most
+ * `2^-(PrecisionBits - 1)`, which allows tracking the whole range of the representation type
+ * in a fixed number of buckets. Recording is O(1) and uses relaxed atomic increments, so a histogram
+ * may be safely updated from many threads. For the lowest overhead, each thread should record into its
+ * own (e.g. `thread_local`) instance and snapshots of those should be merged for reporting.
+ *
+ * @code{.cpp}
+ * quantity_histogram<quantity<si::micro<si::second>, std::int64_t>> latency;
+ * latency.record(125 * us);
+ * const auto p99 = latency.snapshot().percentile(99);
+ * @endcode
+ *
+ * @tparam Q a quantity type with an integral representation type
+ * @tparam PrecisionBits the number of significant bits kept for each recorded value
+ */
+template<Quantity Q, std::size_t PrecisionBits = 7>
+  requires std::integral<typename Q::rep>
+class quantity_histogram {
+  using buckets = detail::log_linear_buckets<typename Q::rep, PrecisionBits>;
+public:
+  using quantity_type = Q;
+  using rep = MP_UNITS_TYPENAME Q::rep;
+  using count_type = std::uint64_t;
+  using snapshot_type = quantity_histogram_snapshot<Q, PrecisionBits>;
+  static constexpr std::size_t bucket_count = buckets::count;
+
+  quantity_histogram() = default;
+  quantity_histogram(const quantity_histogram&) = delete;
+  quantity_histogram& operator=(const quantity_histogram&) = delete;
+
+  /**
+   * @brief Records a value in the histogram
+   *
+   * @note The value must not be negative.
+   */
+  void record(const quantity_type& q, count_type n = 1) noexcept
+  {
+    const rep v = q.numerical_value_ref_in(quantity_type::unit);
+    gsl_Expects(v >= 0);
+    counts_[buckets::index(v)].fetch_add(n, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] count_type count() const noexcept { return snapshot().count(); }
+
+  [[nodiscard]] quantity_type percentile(double p) const noexcept { return snapshot().percentile(p); }
+
+  [[nodiscard]] snapshot_type snapshot() const noexcept
+  {
+    snapshot_type s;
+    for (std::size_t i = 0; i < bucket_count; ++i) s.counts[i] = counts_[i].load(std::memory_order_relaxed);
+    return s;
+  }
+
+  void merge(const snapshot_type& s) noexcept
+  {
+    for (std::size_t i = 0; i < bucket_count; ++i)
+      if (s.counts[i] != 0) counts_[i].fetch_add(s.counts[i], std::memory_order_relaxed);
+  }
+
+  void reset() noexcept
+  {
+    for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] static constexpr std::size_t bucket_index(const quantity_type& q) noexcept
+  {
+    return buckets::index(q.numerical_value_ref_in(quantity_type::unit));
+  }
+
+  [[nodiscard]] static constexpr quantity_type bucket_lower_bound(std::size_t index) noexcept
+  {
+    gsl_Expects(index < bucket_count);
+    return make_quantity<quantity_type::reference>(buckets::lower_bound(index));
+  }
+
+  [[nodiscard]] static constexpr quantity_type bucket_upper_bound(std::size_t index) noexcept
+  {
+    gsl_Expects(index < bucket_count);
+    return make_quantity<quantity_type::reference>(buckets::upper_bound(index));
+  }
+
+private:
+  std::array<std::atomic<count_type>, bucket_count> counts_{};
+};
+
+}  // namespace mp_units
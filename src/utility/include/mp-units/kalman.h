@@ -0,0 +1,307 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/type_traits.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+
+// IWYU pragma: begin_exports
+#include <cstddef>
+// IWYU pragma: end_exports
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mp_units::kalman {
+
+template<typename T>
+concept QuantityOrQuantityPoint = mp_units::Quantity<T> || mp_units::QuantityPoint<T>;
+
+template<mp_units::Dimension auto... Ds>
+inline constexpr bool are_time_derivatives = false;
+
+template<mp_units::Dimension auto D>
+inline constexpr bool are_time_derivatives<D> = true;
+
+template<mp_units::Dimension auto D1, mp_units::Dimension auto D2, mp_units::Dimension auto... Ds>
+inline constexpr bool are_time_derivatives<D1, D2, Ds...> =
+  (D1 / D2 == mp_units::isq::dim_time) && are_time_derivatives<D2, Ds...>;
+
+/**
+ * @brief The state of a Kalman filter: a quantity (point) and its consecutive time derivatives
+ *
+ * The variables are stored in a `std::tuple`, so the state never allocates and all the steps operating
+ * on it are unrolled at compile time for any number of variables.
+ */
+template<QuantityOrQuantityPoint... QQPs>
+  requires(sizeof...(QQPs) > 0) && are_time_derivatives<QQPs::dimension...>
+struct state {
+  std::tuple<QQPs...> variables_;
+  constexpr state(QQPs... qqps) : variables_(std::move(qqps)...) {}
+};
+
+template<typename T>
+concept State = mp_units::is_specialization_of<T, state>;
+
+template<std::size_t Idx, typename... Qs>
+constexpr auto& get(state<Qs...>& s)
+{
+  return get<Idx>(s.variables_);
+}
+
+template<std::size_t Idx, typename... Qs>
+constexpr const auto& get(const state<Qs...>& s)
+{
+  return get<Idx>(s.variables_);
+}
+
+/**
+ * @brief The covariance matrix of the variables of a Kalman filter state
+ *
+ * The elements are stored in a fixed-size row-major array of the numerical values. The element `(I, J)`
+ * is a quantity of `reference<I> * reference<J>` (e.g. `m * m/s` for the covariance of a position and
+ * a velocity), and is accessed with `get<I, J>()` and `set<I, J>()`.
+ */
+template<QuantityOrQuantityPoint... QQPs>
+  requires(sizeof...(QQPs) > 0) && are_time_derivatives<QQPs::dimension...>
+class covariance {
+  template<std::size_t... Is, typename... Vs>
+  constexpr void set_diagonal(std::index_sequence<Is...>, const Vs&... variances)
+  {
+    ((values_[Is * size + Is] = element_type<Is, Is>(variances).numerical_value_in(element_type<Is, Is>::unit)), ...);
+  }
+public:
+  static constexpr std::size_t size = sizeof...(QQPs);
+  using rep = std::common_type_t<typename QQPs::rep...>;
+
+  template<std::size_t I>
+  static constexpr mp_units::Reference auto reference = std::tuple_element_t<I, std::tuple<QQPs...>>::reference;
+
+  template<std::size_t I, std::size_t J>
+  using element_type = mp_units::quantity<reference<I> * reference<J>, rep>;
+
+  // row-major; an element (I, J) is stored in the unit of `reference<I> * reference<J>`
+  std::array<rep, size * size> values_{};
+
+  covariance() = default;
+
+  template<typename... Vs>
+    requires(sizeof...(Vs) == size)
+  constexpr explicit covariance(const Vs&... variances)
+  {
+    set_diagonal(std::index_sequence_for<Vs...>{}, variances...);
+  }
+};
+
+template<typename T>
+concept Covariance = mp_units::is_specialization_of<T, covariance>;
+
+template<std::size_t I, std::size_t J, typename... Qs>
+constexpr auto get(const covariance<Qs...>& c)
+{
+  using cov = covariance<Qs...>;
+  return c.values_[I * cov::size + J] * cov::template element_type<I, J>::reference;
+}
+
+template<std::size_t I, std::size_t J, typename... Qs>
+constexpr void set(covariance<Qs...>& c, const typename covariance<Qs...>::template element_type<I, J>& v)
+{
+  c.values_[I * covariance<Qs...>::size + J] = v.numerical_value_ref_in(v.unit);
+}
+
+// estimation
+template<QuantityOrQuantityPoint QQP, QuantityOrQuantityPoint... QQPs>
+struct estimation {
+private:
+  static constexpr auto uncertainty_ref = QQP::reference * QQP::reference;
+  using uncertainty_type =
+    std::conditional_t<sizeof...(QQPs) == 0, mp_units::quantity<uncertainty_ref, typename QQP::rep>,
+                       covariance<QQP, QQPs...>>;
+public:
+  kalman::state<QQP, QQPs...> state;
+  uncertainty_type uncertainty;
+};
+
+template<QuantityOrQuantityPoint QQP, mp_units::Quantity U>
+estimation(state<QQP>, U) -> estimation<QQP>;
+
+template<QuantityOrQuantityPoint... QQPs>
+estimation(state<QQPs...>, covariance<QQPs...>) -> estimation<QQPs...>;
+
+namespace detail {
+
+// interval^N / N!
+template<std::size_t N, mp_units::QuantityOf<mp_units::isq::time> T>
+constexpr mp_units::Quantity auto pow_over_factorial(T interval)
+{
+  if constexpr (N == 1)
+    return interval;
+  else
+    return pow_over_factorial<N - 1>(interval) * interval / static_cast<typename T::rep>(N);
+}
+
+// x_I + x_(I+1) * interval + x_(I+2) * interval^2 / 2! + ...
+template<std::size_t I, typename... Qs, typename T, std::size_t... Js>
+constexpr auto extrapolate(const state<Qs...>& s, [[maybe_unused]] T interval, std::index_sequence<Js...>)
+{
+  return (get<I>(s) + ... + (get<I + 1 + Js>(s) * pow_over_factorial<1 + Js>(interval)));
+}
+
+// (F * P)(I, J) for the state transition matrix F of the time derivatives chain
+template<std::size_t I, std::size_t J, typename... Qs, typename T, std::size_t... Ks>
+constexpr auto propagate_rows(const covariance<Qs...>& p, [[maybe_unused]] T interval, std::index_sequence<Ks...>)
+{
+  return (get<I, J>(p) + ... + (get<I + 1 + Ks, J>(p) * pow_over_factorial<1 + Ks>(interval)));
+}
+
+// (P * F^T)(I, J) for the state transition matrix F of the time derivatives chain
+template<std::size_t I, std::size_t J, typename... Qs, typename T, std::size_t... Ks>
+constexpr auto propagate_columns(const covariance<Qs...>& p, [[maybe_unused]] T interval, std::index_sequence<Ks...>)
+{
+  return (get<I, J>(p) + ... + (get<I, J + 1 + Ks>(p) * pow_over_factorial<1 + Ks>(interval)));
+}
+
+template<std::size_t I, typename... Qs, typename QM, typename K, typename T>
+constexpr auto correct(const state<Qs...>& predicted, QM measured, K gain, T interval)
+{
+  if constexpr (I == 0)
+    return get<0>(predicted) + gain * (measured - get<0>(predicted));
+  else
+    return get<I>(predicted) + gain * (measured - get<0>(predicted)) / pow_over_factorial<I>(interval);
+}
+
+}  // namespace detail
+
+// kalman gain
+template<mp_units::Quantity Q>
+constexpr mp_units::quantity<mp_units::dimensionless[mp_units::one]> kalman_gain(Q estimate_uncertainty,
+                                                                                 Q measurement_uncertainty)
+{
+  return estimate_uncertainty / (estimate_uncertainty + measurement_uncertainty);
+}
+
+// state update
+template<typename Q, QuantityOrQuantityPoint QM, mp_units::QuantityOf<mp_units::dimensionless> K>
+  requires(Q::quantity_spec == QM::quantity_spec)
+constexpr state<Q> state_update(const state<Q>& predicted, QM measured, K gain)
+{
+  return {get<0>(predicted) + gain * (measured - get<0>(predicted))};
+}
+
+template<typename... Qs, QuantityOrQuantityPoint QM, mp_units::QuantityOf<mp_units::dimensionless> K,
+         mp_units::QuantityOf<mp_units::isq::time> T>
+  requires(sizeof...(Qs) > 1) && (std::tuple_element_t<0, std::tuple<Qs...>>::quantity_spec == QM::quantity_spec)
+constexpr state<Qs...> state_update(const state<Qs...>& predicted, QM measured, std::array<K, sizeof...(Qs)> gain,
+                                    T interval)
+{
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return state<Qs...>{detail::correct<Is>(predicted, measured, get<Is>(gain), interval)...};
+  }(std::index_sequence_for<Qs...>{});
+}
+
+// covariance update
+template<mp_units::Quantity Q, mp_units::QuantityOf<mp_units::dimensionless> K>
+constexpr Q covariance_update(Q uncertainty, K gain)
+{
+  return (1 * mp_units::one - gain) * uncertainty;
+}
+
+// state extrapolation
+template<typename... Qs, mp_units::QuantityOf<mp_units::isq::time> T>
+  requires(sizeof...(Qs) > 1)
+constexpr state<Qs...> state_extrapolation(const state<Qs...>& estimated, T interval)
+{
+  constexpr std::size_t n = sizeof...(Qs);
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return state<Qs...>{detail::extrapolate<Is>(estimated, interval, std::make_index_sequence<n - 1 - Is>{})...};
+  }(std::index_sequence_for<Qs...>{});
+}
+
+// covariance extrapolation
+template<mp_units::Quantity Q>
+constexpr Q covariance_extrapolation(Q uncertainty, Q process_noise_variance)
+{
+  return uncertainty + process_noise_variance;
+}
+
+// F * P * F^T + Q
+template<typename... Qs, mp_units::QuantityOf<mp_units::isq::time> T>
+constexpr covariance<Qs...> covariance_extrapolation(const covariance<Qs...>& uncertainty, T interval,
+                                                     const covariance<Qs...>& process_noise)
+{
+  constexpr std::size_t n = sizeof...(Qs);
+  covariance<Qs...> fp;
+  [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+    (set<Ks / n, Ks % n>(fp, detail::propagate_rows<Ks / n, Ks % n>(uncertainty, interval,
+                                                                      std::make_index_sequence<n - 1 - Ks / n>{})),
+     ...);
+  }(std::make_index_sequence<n * n>{});
+
+  covariance<Qs...> result;
+  [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+    (set<Ks / n, Ks % n>(result, detail::propagate_columns<Ks / n, Ks % n>(
+                                   fp, interval, std::make_index_sequence<n - 1 - Ks % n>{}) +
+                                   get<Ks / n, Ks % n>(process_noise)),
+     ...);
+  }(std::make_index_sequence<n * n>{});
+  return result;
+}
+
+// predict
+template<typename... Qs, mp_units::QuantityOf<mp_units::isq::time> T>
+  requires(sizeof...(Qs) > 1)
+constexpr estimation<Qs...> predict(const estimation<Qs...>& current, T interval,
+                                    const covariance<Qs...>& process_noise)
+{
+  return {state_extrapolation(current.state, interval),
+          covariance_extrapolation(current.uncertainty, interval, process_noise)};
+}
+
+// update with a measurement of the first state variable
+template<typename... Qs, QuantityOrQuantityPoint QM, mp_units::Quantity R>
+  requires(sizeof...(Qs) > 1) && (std::tuple_element_t<0, std::tuple<Qs...>>::quantity_spec == QM::quantity_spec)
+constexpr estimation<Qs...> update(const estimation<Qs...>& predicted, QM measured, R measurement_uncertainty)
+{
+  constexpr std::size_t n = sizeof...(Qs);
+  const auto& p = predicted.uncertainty;
+  const auto innovation_uncertainty = get<0, 0>(p) + measurement_uncertainty;
+  const auto innovation = measured - get<0>(predicted.state);
+
+  const state<Qs...> s = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return state<Qs...>{get<Is>(predicted.state) + get<Is, 0>(p) / innovation_uncertainty * innovation...};
+  }(std::make_index_sequence<n>{});
+
+  covariance<Qs...> c;
+  [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+    (set<Ks / n, Ks % n>(c, get<Ks / n, Ks % n>(p) - get<Ks / n, 0>(p) / innovation_uncertainty * get<0, Ks % n>(p)),
+     ...);
+  }(std::make_index_sequence<n * n>{});
+
+  return {s, c};
+}
+
+}  // namespace mp_units::kalman
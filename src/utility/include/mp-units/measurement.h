@@ -0,0 +1,366 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <gsl/gsl-lite.hpp>
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/customization_points.h>
+#include <mp-units/quantity.h>
+
+// IWYU pragma: begin_exports
+#include <cstddef>
+// IWYU pragma: end_exports
+
+#include <cmath>
+#include <compare>
+#include <ostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mp_units {
+
+/**
+ * @brief A representation type of a measured value with its standard uncertainty
+ *
+ * The uncertainty is propagated to the first order under the assumption that the operands are
+ * not correlated (use `sum`, `difference`, `product`, and `quotient` with a correlation
+ * coefficient otherwise). The value is stored together with its variance, so that the
+ * propagation through a chain of operations needs only multiplications and additions;
+ * the square root is taken only when the uncertainty is requested.
+ *
+ * @tparam T the type of the value and of the uncertainty
+ */
+template<typename T>
+class measurement {
+public:
+  using value_type = T;
+
+  measurement() = default;
+
+  constexpr explicit measurement(value_type val, const value_type& err = {}) :
+      value_(std::move(val)), variance_(err * err)
+  {
+  }
+
+  [[nodiscard]] static constexpr measurement from_variance(value_type val, value_type variance)
+  {
+    measurement res;
+    res.value_ = std::move(val);
+    res.variance_ = std::move(variance);
+    return res;
+  }
+
+  [[nodiscard]] constexpr const value_type& value() const { return value_; }
+  [[nodiscard]] constexpr const value_type& variance() const { return variance_; }
+
+  [[nodiscard]] value_type uncertainty() const
+  {
+    using std::sqrt;
+    return static_cast<value_type>(sqrt(variance_));
+  }
+
+  [[nodiscard]] value_type relative_uncertainty() const { return uncertainty() / value(); }
+  [[nodiscard]] value_type lower_bound() const { return value() - uncertainty(); }
+  [[nodiscard]] value_type upper_bound() const { return value() + uncertainty(); }
+
+  [[nodiscard]] constexpr measurement operator+() const { return *this; }
+  [[nodiscard]] constexpr measurement operator-() const { return from_variance(-value_, variance_); }
+
+  constexpr measurement& operator+=(const measurement& other)
+  {
+    value_ += other.value_;
+    variance_ += other.variance_;
+    return *this;
+  }
+
+  constexpr measurement& operator-=(const measurement& other)
+  {
+    value_ -= other.value_;
+    variance_ += other.variance_;
+    return *this;
+  }
+
+  constexpr measurement& operator*=(const measurement& other)
+  {
+    variance_ = other.value_ * other.value_ * variance_ + value_ * value_ * other.variance_;
+    value_ *= other.value_;
+    return *this;
+  }
+
+  constexpr measurement& operator/=(const measurement& other)
+  {
+    value_ /= other.value_;
+    variance_ = (variance_ + value_ * value_ * other.variance_) / (other.value_ * other.value_);
+    return *this;
+  }
+
+  constexpr measurement& operator*=(const value_type& v)
+  {
+    value_ *= v;
+    variance_ *= v * v;
+    return *this;
+  }
+
+  constexpr measurement& operator/=(const value_type& v)
+  {
+    value_ /= v;
+    variance_ /= v * v;
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr measurement operator+(measurement lhs, const measurement& rhs) { return lhs += rhs; }
+  [[nodiscard]] friend constexpr measurement operator-(measurement lhs, const measurement& rhs) { return lhs -= rhs; }
+  [[nodiscard]] friend constexpr measurement operator*(measurement lhs, const measurement& rhs) { return lhs *= rhs; }
+  [[nodiscard]] friend constexpr measurement operator/(measurement lhs, const measurement& rhs) { return lhs /= rhs; }
+
+  [[nodiscard]] friend constexpr measurement operator*(measurement lhs, const value_type& value)
+  {
+    return lhs *= value;
+  }
+
+  [[nodiscard]] friend constexpr measurement operator*(const value_type& value, measurement rhs)
+  {
+    return rhs *= value;
+  }
+
+  [[nodiscard]] friend constexpr measurement operator/(measurement lhs, const value_type& value)
+  {
+    return lhs /= value;
+  }
+
+  [[nodiscard]] friend constexpr measurement operator/(const value_type& value, const measurement& rhs)
+  {
+    const value_type val = value / rhs.value_;
+    return from_variance(val, val * val * rhs.variance_ / (rhs.value_ * rhs.value_));
+  }
+
+  [[nodiscard]] constexpr auto operator<=>(const measurement&) const = default;
+
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const measurement& v)
+  {
+    return os << v.value() << " ± " << v.uncertainty();
+  }
+
+private:
+  value_type value_{};
+  value_type variance_{};
+};
+
+/**
+ * @brief Correlation-aware propagation of the uncertainty
+ *
+ * @param correlation the correlation coefficient of the operands in the range [-1, 1]
+ */
+template<typename T>
+[[nodiscard]] measurement<T> sum(const measurement<T>& lhs, const measurement<T>& rhs, const T& correlation)
+{
+  const T covariance = correlation * lhs.uncertainty() * rhs.uncertainty();
+  return measurement<T>::from_variance(lhs.value() + rhs.value(), lhs.variance() + rhs.variance() + 2 * covariance);
+}
+
+template<typename T>
+[[nodiscard]] measurement<T> difference(const measurement<T>& lhs, const measurement<T>& rhs, const T& correlation)
+{
+  const T covariance = correlation * lhs.uncertainty() * rhs.uncertainty();
+  return measurement<T>::from_variance(lhs.value() - rhs.value(), lhs.variance() + rhs.variance() - 2 * covariance);
+}
+
+template<typename T>
+[[nodiscard]] measurement<T> product(const measurement<T>& lhs, const measurement<T>& rhs, const T& correlation)
+{
+  const T covariance = correlation * lhs.uncertainty() * rhs.uncertainty();
+  const T& a = lhs.value();
+  const T& b = rhs.value();
+  return measurement<T>::from_variance(a * b,
+                                       b * b * lhs.variance() + a * a * rhs.variance() + 2 * a * b * covariance);
+}
+
+template<typename T>
+[[nodiscard]] measurement<T> quotient(const measurement<T>& lhs, const measurement<T>& rhs, const T& correlation)
+{
+  const T covariance = correlation * lhs.uncertainty() * rhs.uncertainty();
+  const T& b = rhs.value();
+  const T q = lhs.value() / b;
+  return measurement<T>::from_variance(q, (lhs.variance() + q * q * rhs.variance() - 2 * q * covariance) / (b * b));
+}
+
+template<auto R1, typename T, auto R2>
+  requires requires(quantity<R1, measurement<T>> q1, quantity<R2, measurement<T>> q2) { q1 + q2; }
+[[nodiscard]] Quantity auto sum(const quantity<R1, measurement<T>>& lhs, const quantity<R2, measurement<T>>& rhs,
+                                const T& correlation)
+{
+  using ret = decltype(lhs + rhs);
+  return make_quantity<ret::reference>(
+    sum(ret(lhs).numerical_value_in(ret::unit), ret(rhs).numerical_value_in(ret::unit), correlation));
+}
+
+template<auto R1, typename T, auto R2>
+  requires requires(quantity<R1, measurement<T>> q1, quantity<R2, measurement<T>> q2) { q1 - q2; }
+[[nodiscard]] Quantity auto difference(const quantity<R1, measurement<T>>& lhs,
+                                       const quantity<R2, measurement<T>>& rhs, const T& correlation)
+{
+  using ret = decltype(lhs - rhs);
+  return make_quantity<ret::reference>(
+    difference(ret(lhs).numerical_value_in(ret::unit), ret(rhs).numerical_value_in(ret::unit), correlation));
+}
+
+template<auto R1, typename T, auto R2>
+[[nodiscard]] Quantity auto product(const quantity<R1, measurement<T>>& lhs, const quantity<R2, measurement<T>>& rhs,
+                                    const T& correlation)
+{
+  return make_quantity<R1 * R2>(
+    product(lhs.numerical_value_ref_in(lhs.unit), rhs.numerical_value_ref_in(rhs.unit), correlation));
+}
+
+template<auto R1, typename T, auto R2>
+[[nodiscard]] Quantity auto quotient(const quantity<R1, measurement<T>>& lhs, const quantity<R2, measurement<T>>& rhs,
+                                     const T& correlation)
+{
+  return make_quantity<R1 / R2>(
+    quotient(lhs.numerical_value_ref_in(lhs.unit), rhs.numerical_value_ref_in(rhs.unit), correlation));
+}
+
+/**
+ * @brief A structure-of-arrays container of measurements
+ *
+ * The values and the variances are stored in two contiguous arrays, so the element-wise
+ * operations compile to vectorized loops.
+ *
+ * @tparam T the type of the values and of the uncertainties
+ */
+template<typename T>
+class measurement_vector {
+  std::vector<T> values_;
+  std::vector<T> variances_;
+
+  template<typename F>
+  [[nodiscard]] friend measurement_vector transform(const measurement_vector& lhs, const measurement_vector& rhs, F f)
+  {
+    gsl_Expects(lhs.size() == rhs.size());
+    measurement_vector res(lhs.size());
+    const T* a = lhs.values_.data();
+    const T* va = lhs.variances_.data();
+    const T* b = rhs.values_.data();
+    const T* vb = rhs.variances_.data();
+    T* r = res.values_.data();
+    T* vr = res.variances_.data();
+    for (std::size_t i = 0; i < res.size(); ++i) f(a[i], va[i], b[i], vb[i], r[i], vr[i]);
+    return res;
+  }
+
+public:
+  using value_type = measurement<T>;
+
+  measurement_vector() = default;
+  explicit measurement_vector(std::size_t count) : values_(count), variances_(count) {}
+
+  [[nodiscard]] std::size_t size() const { return values_.size(); }
+  [[nodiscard]] bool empty() const { return values_.empty(); }
+
+  void reserve(std::size_t count)
+  {
+    values_.reserve(count);
+    variances_.reserve(count);
+  }
+
+  void push_back(const measurement<T>& m)
+  {
+    values_.push_back(m.value());
+    variances_.push_back(m.variance());
+  }
+
+  [[nodiscard]] measurement<T> operator[](std::size_t i) const
+  {
+    return measurement<T>::from_variance(values_[i], variances_[i]);
+  }
+
+  [[nodiscard]] std::span<const T> values() const { return values_; }
+  [[nodiscard]] std::span<const T> variances() const { return variances_; }
+
+  [[nodiscard]] std::vector<T> uncertainties() const
+  {
+    std::vector<T> res(size());
+    for (std::size_t i = 0; i < res.size(); ++i) {
+      using std::sqrt;
+      res[i] = static_cast<T>(sqrt(variances_[i]));
+    }
+    return res;
+  }
+
+  [[nodiscard]] friend measurement_vector operator+(const measurement_vector& lhs, const measurement_vector& rhs)
+  {
+    return transform(lhs, rhs, [](T a, T va, T b, T vb, T& r, T& vr) {
+      r = a + b;
+      vr = va + vb;
+    });
+  }
+
+  [[nodiscard]] friend measurement_vector operator-(const measurement_vector& lhs, const measurement_vector& rhs)
+  {
+    return transform(lhs, rhs, [](T a, T va, T b, T vb, T& r, T& vr) {
+      r = a - b;
+      vr = va + vb;
+    });
+  }
+
+  [[nodiscard]] friend measurement_vector operator*(const measurement_vector& lhs, const measurement_vector& rhs)
+  {
+    return transform(lhs, rhs, [](T a, T va, T b, T vb, T& r, T& vr) {
+      r = a * b;
+      vr = b * b * va + a * a * vb;
+    });
+  }
+
+  [[nodiscard]] friend measurement_vector operator/(const measurement_vector& lhs, const measurement_vector& rhs)
+  {
+    return transform(lhs, rhs, [](T a, T va, T b, T vb, T& r, T& vr) {
+      r = a / b;
+      vr = (va + r * r * vb) / (b * b);
+    });
+  }
+
+  [[nodiscard]] friend measurement_vector operator*(measurement_vector lhs, const T& value)
+  {
+    const T value2 = value * value;
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+      lhs.values_[i] *= value;
+      lhs.variances_[i] *= value2;
+    }
+    return lhs;
+  }
+
+  [[nodiscard]] friend measurement_vector operator*(const T& value, measurement_vector rhs)
+  {
+    return std::move(rhs) * value;
+  }
+};
+
+template<class T>
+inline constexpr bool is_scalar<measurement<T>> = true;
+
+template<class T>
+inline constexpr bool is_vector<measurement<T>> = true;
+
+}  // namespace mp_units
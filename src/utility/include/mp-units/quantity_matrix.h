@@ -0,0 +1,416 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <gsl/gsl-lite.hpp>
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/bits/representation_concepts.h>
+#include <mp-units/customization_points.h>
+#include <mp-units/quantity.h>
+#include <mp-units/reference.h>
+#include <mp-units/unit.h>
+
+// IWYU pragma: begin_exports
+#include <cstddef>
+// IWYU pragma: end_exports
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mp_units {
+
+/**
+ * @brief A compile-time list of references describing the rows or the columns of a `quantity_matrix`
+ */
+template<Reference auto... Rs>
+struct references {
+  static constexpr std::size_t size = sizeof...(Rs);
+
+  template<std::size_t I>
+    requires(I < size)
+  static constexpr Reference auto get = std::tuple_element_t<I, std::tuple<decltype(Rs)...>>{};
+};
+
+namespace detail {
+
+inline constexpr std::size_t max_unrolled_size = 6;
+
+// calls `f` for every index in [0, N); small extents are unrolled at compile time
+template<std::size_t N, typename F>
+constexpr void static_for(F&& f)
+{
+  if constexpr (N <= max_unrolled_size)
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (f(std::size_t{Is}), ...);
+    }(std::make_index_sequence<N>{});
+  else
+    for (std::size_t i = 0; i < N; ++i) f(i);
+}
+
+// a dimensionless factor is not applied to the references of a matrix product so that,
+// for example, `F * P * transpose(F)` has the same type as the covariance `P`
+template<Reference auto R, Reference auto Factor>
+[[nodiscard]] consteval Reference auto scale_reference()
+{
+  if constexpr (Factor == one)
+    return R;
+  else
+    return R * Factor;
+}
+
+}  // namespace detail
+
+template<typename Rows, typename Columns, Representation Rep = double>
+class quantity_matrix;
+
+template<typename T>
+concept QuantityMatrix = is_specialization_of<T, quantity_matrix>;
+
+/**
+ * @brief A small dense matrix of quantities with a unit assigned to every entry
+ *
+ * The rows and the columns of the matrix are described by lists of references, and the entry
+ * `(i, j)` is a quantity of `Rows[i] * Columns[j]`. This is the natural form of covariance
+ * matrices (`Rows == Columns == state`) and of Jacobians (`Rows == outputs`, `Columns == 1 / inputs`).
+ *
+ * The numerical values are stored in a contiguous row-major array of `Rep`, each in the unit of its
+ * entry, so arithmetic never converts between units. The loops of the multiplication and the
+ * inversion of matrices up to 6 x 6 are unrolled at compile time.
+ *
+ * @tparam Rows references of the rows
+ * @tparam Columns references of the columns
+ * @tparam Rep a type to be used to represent the values of the entries
+ */
+template<Reference auto... Rows, Reference auto... Columns, Representation Rep>
+  requires(sizeof...(Rows) > 0) && (sizeof...(Columns) > 0)
+class quantity_matrix<references<Rows...>, references<Columns...>, Rep> {
+  std::array<Rep, sizeof...(Rows) * sizeof...(Columns)> values_{};
+
+public:
+  using row_references = references<Rows...>;
+  using column_references = references<Columns...>;
+  using rep = Rep;
+
+  static constexpr std::size_t rows = sizeof...(Rows);
+  static constexpr std::size_t columns = sizeof...(Columns);
+
+  template<std::size_t I>
+  static constexpr Reference auto row_reference = row_references::template get<I>;
+
+  template<std::size_t J>
+  static constexpr Reference auto column_reference = column_references::template get<J>;
+
+  template<std::size_t I, std::size_t J>
+  static constexpr Reference auto reference = row_reference<I> * column_reference<J>;
+
+  template<std::size_t I, std::size_t J>
+  using element_type = quantity<reference<I, J>, Rep>;
+
+private:
+  template<typename Other, std::size_t... Is>
+  static consteval bool entries_constructible_from(std::index_sequence<Is...>)
+  {
+    if constexpr (Other::rows != rows || Other::columns != columns)
+      return false;
+    else
+      return (std::constructible_from<element_type<Is / columns, Is % columns>,
+                                      typename Other::template element_type<Is / columns, Is % columns>> &&
+              ...);
+  }
+
+  template<typename Other, std::size_t... Is>
+  static consteval bool entries_convertible_from(std::index_sequence<Is...>)
+  {
+    return (std::convertible_to<typename Other::template element_type<Is / columns, Is % columns>,
+                                element_type<Is / columns, Is % columns>> &&
+            ...);
+  }
+
+  template<typename Other, std::size_t... Is>
+  constexpr void assign(const Other& other, std::index_sequence<Is...>)
+  {
+    ((values_[Is] = element_type<Is / columns, Is % columns>(get<Is / columns, Is % columns>(other))
+                      .numerical_value_in(element_type<Is / columns, Is % columns>::unit)),
+     ...);
+  }
+
+  template<typename Other, std::size_t... Ks>
+  static consteval bool multipliable(std::index_sequence<Ks...>)
+  {
+    if constexpr (Other::rows != columns)
+      return false;
+    else {
+      constexpr auto inner = column_reference<0> * Other::template row_reference<0>;
+      return ((get_unit(column_reference<Ks> * Other::template row_reference<Ks>) == get_unit(inner) &&
+               implicitly_convertible(get_quantity_spec(column_reference<Ks> * Other::template row_reference<Ks>),
+                                      get_quantity_spec(inner))) &&
+              ...);
+    }
+  }
+
+  static constexpr std::size_t index(std::size_t i, std::size_t j) { return i * columns + j; }
+
+public:
+  quantity_matrix() = default;
+
+  /**
+   * @brief Converts every entry of a matrix with the same shape to the units of this matrix
+   *
+   * The conversion is implicit only if all the entries are implicitly convertible.
+   */
+  template<typename R, typename C, typename Rep2>
+    requires(!std::same_as<quantity_matrix<R, C, Rep2>, quantity_matrix>) &&
+            (entries_constructible_from<quantity_matrix<R, C, Rep2>>(std::make_index_sequence<rows * columns>{}))
+  constexpr explicit(!entries_convertible_from<quantity_matrix<R, C, Rep2>>(std::make_index_sequence<rows * columns>{}))
+    quantity_matrix(const quantity_matrix<R, C, Rep2>& other)
+  {
+    assign(other, std::make_index_sequence<rows * columns>{});
+  }
+
+  /**
+   * @brief Returns a matrix with the quantities `values` on its diagonal
+   */
+  template<typename... Qs>
+    requires(rows == columns) && (sizeof...(Qs) == rows)
+  [[nodiscard]] static constexpr quantity_matrix diagonal(const Qs&... values)
+  {
+    quantity_matrix res;
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (set<Is, Is>(res, values), ...);
+    }(std::index_sequence_for<Qs...>{});
+    return res;
+  }
+
+  // contiguous row-major numerical values, each in the unit of its entry
+  [[nodiscard]] constexpr Rep* data() noexcept { return values_.data(); }
+  [[nodiscard]] constexpr const Rep* data() const noexcept { return values_.data(); }
+
+  template<std::size_t I, std::size_t J>
+    requires(I < rows) && (J < columns)
+  [[nodiscard]] friend constexpr element_type<I, J> get(const quantity_matrix& m)
+  {
+    return make_quantity<reference<I, J>>(m.values_[index(I, J)]);
+  }
+
+  template<std::size_t I, std::size_t J>
+    requires(I < rows) && (J < columns)
+  friend constexpr void set(quantity_matrix& m, const element_type<I, J>& q)
+  {
+    m.values_[index(I, J)] = q.numerical_value_ref_in(q.unit);
+  }
+
+  [[nodiscard]] constexpr quantity_matrix operator+() const { return *this; }
+
+  [[nodiscard]] constexpr quantity_matrix operator-() const
+  {
+    quantity_matrix res;
+    for (std::size_t i = 0; i < values_.size(); ++i) res.values_[i] = -values_[i];
+    return res;
+  }
+
+  constexpr quantity_matrix& operator+=(const quantity_matrix& other)
+  {
+    for (std::size_t i = 0; i < values_.size(); ++i) values_[i] += other.values_[i];
+    return *this;
+  }
+
+  constexpr quantity_matrix& operator-=(const quantity_matrix& other)
+  {
+    for (std::size_t i = 0; i < values_.size(); ++i) values_[i] -= other.values_[i];
+    return *this;
+  }
+
+  template<Representation Value>
+    requires requires(Rep& a, const Value& b) { a *= b; }
+  constexpr quantity_matrix& operator*=(const Value& value)
+  {
+    for (auto& v : values_) v *= value;
+    return *this;
+  }
+
+  template<Representation Value>
+    requires requires(Rep& a, const Value& b) { a /= b; }
+  constexpr quantity_matrix& operator/=(const Value& value)
+  {
+    for (auto& v : values_) v /= value;
+    return *this;
+  }
+
+  [[nodiscard]] friend constexpr quantity_matrix operator+(quantity_matrix lhs, const quantity_matrix& rhs)
+  {
+    return lhs += rhs;
+  }
+
+  [[nodiscard]] friend constexpr quantity_matrix operator-(quantity_matrix lhs, const quantity_matrix& rhs)
+  {
+    return lhs -= rhs;
+  }
+
+  template<Representation Value>
+    requires requires(Rep& a, const Value& b) { a *= b; }
+  [[nodiscard]] friend constexpr quantity_matrix operator*(quantity_matrix lhs, const Value& rhs)
+  {
+    return lhs *= rhs;
+  }
+
+  template<Representation Value>
+    requires requires(Rep& a, const Value& b) { a *= b; }
+  [[nodiscard]] friend constexpr quantity_matrix operator*(const Value& lhs, quantity_matrix rhs)
+  {
+    return rhs *= lhs;
+  }
+
+  template<Representation Value>
+    requires requires(Rep& a, const Value& b) { a /= b; }
+  [[nodiscard]] friend constexpr quantity_matrix operator/(quantity_matrix lhs, const Value& rhs)
+  {
+    return lhs /= rhs;
+  }
+
+  /**
+   * @brief Scales every entry by a scalar quantity
+   *
+   * The reference of the quantity is applied to the columns of the result.
+   */
+  template<Quantity Q>
+    requires is_scalar<typename Q::rep>
+  [[nodiscard]] friend constexpr auto operator*(const quantity_matrix& lhs, const Q& rhs)
+  {
+    using ret = quantity_matrix<row_references, references<(Columns * Q::reference)...>,
+                                decltype(std::declval<Rep>() * std::declval<typename Q::rep>())>;
+    ret res;
+    const auto& v = rhs.numerical_value_ref_in(rhs.unit);
+    for (std::size_t i = 0; i < lhs.values_.size(); ++i) res.data()[i] = lhs.values_[i] * v;
+    return res;
+  }
+
+  /**
+   * @brief Scales every entry by a scalar quantity
+   *
+   * The reference of the quantity is applied to the rows of the result.
+   */
+  template<Quantity Q>
+    requires is_scalar<typename Q::rep>
+  [[nodiscard]] friend constexpr auto operator*(const Q& lhs, const quantity_matrix& rhs)
+  {
+    using ret = quantity_matrix<references<(Q::reference * Rows)...>, column_references,
+                                decltype(std::declval<typename Q::rep>() * std::declval<Rep>())>;
+    ret res;
+    const auto& v = lhs.numerical_value_ref_in(lhs.unit);
+    for (std::size_t i = 0; i < rhs.values_.size(); ++i) res.data()[i] = v * rhs.values_[i];
+    return res;
+  }
+
+  /**
+   * @brief Multiplies two matrices
+   *
+   * All the products `Columns[k] * OtherRows[k]` have to be expressed in the same unit and be
+   * implicitly convertible to the first of them, which is then applied to the rows of the result.
+   */
+  template<typename R, typename C, typename Rep2>
+    requires(multipliable<quantity_matrix<R, C, Rep2>>(std::make_index_sequence<columns>{}))
+  [[nodiscard]] friend constexpr auto operator*(const quantity_matrix& lhs, const quantity_matrix<R, C, Rep2>& rhs)
+  {
+    using other = quantity_matrix<R, C, Rep2>;
+    constexpr auto inner = column_reference<0> * other::template row_reference<0>;
+    using ret = quantity_matrix<references<detail::scale_reference<Rows, inner>()...>, C,
+                                decltype(std::declval<Rep>() * std::declval<Rep2>())>;
+    ret res;
+    detail::static_for<rows>([&](std::size_t i) {
+      detail::static_for<other::columns>([&](std::size_t j) {
+        auto sum = lhs.values_[i * columns] * rhs.data()[j];
+        detail::static_for<columns - 1>([&](std::size_t k) {
+          sum += lhs.values_[i * columns + k + 1] * rhs.data()[(k + 1) * other::columns + j];
+        });
+        res.data()[i * other::columns + j] = sum;
+      });
+    });
+    return res;
+  }
+
+  [[nodiscard]] friend constexpr quantity_matrix<column_references, row_references, Rep> transpose(
+    const quantity_matrix& m)
+  {
+    quantity_matrix<column_references, row_references, Rep> res;
+    detail::static_for<rows>([&](std::size_t i) {
+      detail::static_for<columns>([&](std::size_t j) { res.data()[j * rows + i] = m.values_[i * columns + j]; });
+    });
+    return res;
+  }
+
+  /**
+   * @brief Computes the inverse of a square matrix
+   *
+   * The inverse of a matrix with rows `R` and columns `C` has rows `1 / C` and columns `1 / R`, so
+   * that the product of both is dimensionless. Gauss-Jordan elimination with partial pivoting is used.
+   *
+   * @pre The matrix is not singular
+   */
+  [[nodiscard]] friend constexpr quantity_matrix<references<inverse(Columns)...>, references<inverse(Rows)...>, Rep>
+  inverse(const quantity_matrix& m)
+    requires(rows == columns) && treat_as_floating_point<Rep>
+  {
+    constexpr std::size_t n = rows;
+    std::array<Rep, n * n> a = m.values_;
+    quantity_matrix<references<inverse(Columns)...>, references<inverse(Rows)...>, Rep> res;
+    Rep* inv = res.data();
+    detail::static_for<n>([&](std::size_t i) { inv[i * n + i] = Rep{1}; });
+
+    detail::static_for<n>([&](std::size_t c) {
+      using std::abs;
+      std::size_t pivot = c;
+      detail::static_for<n>([&](std::size_t r) {
+        if (r > c && abs(a[r * n + c]) > abs(a[pivot * n + c])) pivot = r;
+      });
+      gsl_Expects(a[pivot * n + c] != Rep{0});
+      if (pivot != c) {
+        detail::static_for<n>([&](std::size_t k) {
+          std::swap(a[c * n + k], a[pivot * n + k]);
+          std::swap(inv[c * n + k], inv[pivot * n + k]);
+        });
+      }
+      const Rep scale = Rep{1} / a[c * n + c];
+      detail::static_for<n>([&](std::size_t k) {
+        a[c * n + k] *= scale;
+        inv[c * n + k] *= scale;
+      });
+      detail::static_for<n>([&](std::size_t r) {
+        if (r == c) return;
+        const Rep factor = a[r * n + c];
+        detail::static_for<n>([&](std::size_t k) {
+          a[r * n + k] -= factor * a[c * n + k];
+          inv[r * n + k] -= factor * inv[c * n + k];
+        });
+      });
+    });
+    return res;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(const quantity_matrix&, const quantity_matrix&) = default;
+};
+
+}  // namespace mp_units
@@ -0,0 +1,279 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <mp-units/bits/external/hacks.h>
+#include <mp-units/customization_points.h>
+#include <mp-units/quantity.h>
+#include <mp-units/quantity_spec.h>
+
+// IWYU pragma: begin_exports
+#include <cmath>
+#include <cstddef>
+// IWYU pragma: end_exports
+
+#include <array>
+#include <concepts>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace mp_units {
+
+/**
+ * @brief A fixed-size vector to be used as a representation type of vector quantities
+ *
+ * The elements are stored in an array padded to a multiple of 4 lanes and aligned for SIMD
+ * loads so that the element-wise operations compile to full-width vector instructions.
+ * The values of the padding lanes are unspecified and never observable.
+ *
+ * @tparam Rep the type of the elements
+ * @tparam N the number of elements
+ */
+template<typename Rep, std::size_t N>
+  requires(N > 0)
+class vec {
+  template<typename R, std::size_t M>
+    requires(M > 0)
+  friend class vec;
+
+  static constexpr std::size_t lanes = (N + 3) / 4 * 4;
+  static constexpr std::size_t alignment = std::is_arithmetic_v<Rep> ? sizeof(Rep) * 4 : alignof(Rep);
+
+  alignas(alignment) std::array<Rep, lanes> data_{};
+
+  template<typename F>
+  [[nodiscard]] constexpr auto transform(F f) const
+  {
+    vec<decltype(f(data_[0])), N> res;
+    for (std::size_t i = 0; i < lanes; ++i) res.data_[i] = f(data_[i]);
+    return res;
+  }
+
+  template<typename U, typename F>
+  [[nodiscard]] constexpr auto transform(const vec<U, N>& other, F f) const
+  {
+    vec<decltype(f(data_[0], other.data_[0])), N> res;
+    for (std::size_t i = 0; i < lanes; ++i) res.data_[i] = f(data_[i], other.data_[i]);
+    return res;
+  }
+
+public:
+  using value_type = Rep;
+
+  vec() = default;
+
+  template<std::convertible_to<Rep>... Ts>
+    requires(sizeof...(Ts) == N)
+  constexpr explicit(N == 1) vec(const Ts&... values) : data_{static_cast<Rep>(values)...}
+  {
+  }
+
+  template<typename U>
+    requires(!std::same_as<U, Rep>) && std::constructible_from<Rep, const U&>
+  constexpr explicit(!std::convertible_to<const U&, Rep>) vec(const vec<U, N>& other)
+  {
+    for (std::size_t i = 0; i < N; ++i) data_[i] = static_cast<Rep>(other.data_[i]);
+  }
+
+  [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+  [[nodiscard]] constexpr Rep& operator[](std::size_t i) { return data_[i]; }
+  [[nodiscard]] constexpr const Rep& operator[](std::size_t i) const { return data_[i]; }
+  [[nodiscard]] constexpr Rep& operator()(std::size_t i) { return data_[i]; }
+  [[nodiscard]] constexpr const Rep& operator()(std::size_t i) const { return data_[i]; }
+
+  [[nodiscard]] constexpr Rep* data() noexcept { return data_.data(); }
+  [[nodiscard]] constexpr const Rep* data() const noexcept { return data_.data(); }
+
+  [[nodiscard]] constexpr vec operator+() const { return *this; }
+  [[nodiscard]] constexpr auto operator-() const
+  {
+    return transform([](const Rep& v) { return -v; });
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator+(const vec& lhs, const vec<U, N>& rhs)
+  {
+    return lhs.transform(rhs, [](const Rep& a, const U& b) { return a + b; });
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto operator-(const vec& lhs, const vec<U, N>& rhs)
+  {
+    return lhs.transform(rhs, [](const Rep& a, const U& b) { return a - b; });
+  }
+
+  template<typename U>
+    requires(!is_vector<U>)
+  [[nodiscard]] friend constexpr auto operator*(const vec& lhs, const U& rhs)
+    -> vec<decltype(std::declval<const Rep&>() * rhs), N>
+  {
+    return lhs.transform([&](const Rep& a) { return a * rhs; });
+  }
+
+  template<typename U>
+    requires(!is_vector<U>)
+  [[nodiscard]] friend constexpr auto operator*(const U& lhs, const vec& rhs)
+    -> vec<decltype(lhs * std::declval<const Rep&>()), N>
+  {
+    return rhs.transform([&](const Rep& b) { return lhs * b; });
+  }
+
+  // the padding lanes are not divided to not trap on an integral division by zero
+  template<typename U>
+    requires(!is_vector<U>)
+  [[nodiscard]] friend constexpr auto operator/(const vec& lhs, const U& rhs)
+    -> vec<decltype(std::declval<const Rep&>() / rhs), N>
+  {
+    vec<decltype(lhs[0] / rhs), N> res;
+    for (std::size_t i = 0; i < N; ++i) res[i] = lhs[i] / rhs;
+    return res;
+  }
+
+  template<typename U>
+  constexpr vec& operator+=(const vec<U, N>& other)
+  {
+    for (std::size_t i = 0; i < lanes; ++i) data_[i] += other.data_[i];
+    return *this;
+  }
+
+  template<typename U>
+  constexpr vec& operator-=(const vec<U, N>& other)
+  {
+    for (std::size_t i = 0; i < lanes; ++i) data_[i] -= other.data_[i];
+    return *this;
+  }
+
+  template<typename U>
+    requires(!is_vector<U>)
+  constexpr vec& operator*=(const U& value)
+  {
+    for (std::size_t i = 0; i < lanes; ++i) data_[i] *= value;
+    return *this;
+  }
+
+  template<typename U>
+    requires(!is_vector<U>)
+  constexpr vec& operator/=(const U& value)
+  {
+    for (std::size_t i = 0; i < N; ++i) data_[i] /= value;
+    return *this;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr bool operator==(const vec& lhs, const vec<U, N>& rhs)
+  {
+    for (std::size_t i = 0; i < N; ++i)
+      if (!(lhs[i] == rhs[i])) return false;
+    return true;
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr auto dot(const vec& lhs, const vec<U, N>& rhs)
+  {
+    decltype(lhs[0] * rhs[0]) res{};
+    for (std::size_t i = 0; i < N; ++i) res += lhs[i] * rhs[i];
+    return res;
+  }
+
+  template<typename U>
+    requires(N == 3)
+  [[nodiscard]] friend constexpr auto cross(const vec& lhs, const vec<U, N>& rhs)
+  {
+    const auto& a = lhs;
+    const auto& b = rhs;
+    return vec<decltype(a[0] * b[0]), 3>{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2],
+                                         a[0] * b[1] - a[1] * b[0]};
+  }
+
+  [[nodiscard]] friend auto norm(const vec& v)
+  {
+    using std::sqrt;
+    return sqrt(dot(v, v));
+  }
+
+  template<typename CharT, typename Traits>
+  friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const vec& v)
+  {
+    os << '[';
+    for (std::size_t i = 0; i < N; ++i) {
+      if (i != 0) os << ", ";
+      os << v.data_[i];
+    }
+    return os << ']';
+  }
+};
+
+template<typename Rep, std::size_t N>
+inline constexpr bool is_vector<vec<Rep, N>> = true;
+
+template<typename Rep, std::size_t N>
+inline constexpr bool treat_as_floating_point<vec<Rep, N>> = treat_as_floating_point<Rep>;
+
+/**
+ * @brief Computes the scalar product of two vector quantities
+ *
+ * @tparam QS the scalar quantity specification of the result (e.g. `isq::work` for a force and a displacement)
+ */
+template<QuantitySpec auto QS, Quantity Q1, Quantity Q2>
+  requires is_vector<typename Q1::rep> && is_vector<typename Q2::rep> && (QS.character == quantity_character::scalar) &&
+           (implicitly_convertible(Q1::quantity_spec * Q2::quantity_spec, QS)) &&
+           requires(const Q1::rep& v1, const Q2::rep& v2) { dot(v1, v2); }
+[[nodiscard]] constexpr QuantityOf<QS> auto dot(const Q1& q1, const Q2& q2)
+{
+  return make_quantity<QS[Q1::unit * Q2::unit]>(
+    dot(q1.numerical_value_ref_in(q1.unit), q2.numerical_value_ref_in(q2.unit)));
+}
+
+/**
+ * @brief Computes the vector product of two vector quantities
+ */
+template<Quantity Q1, Quantity Q2>
+  requires is_vector<typename Q1::rep> && is_vector<typename Q2::rep> &&
+           requires(const Q1::rep& v1, const Q2::rep& v2) { cross(v1, v2); }
+[[nodiscard]] constexpr QuantityOf<Q1::quantity_spec * Q2::quantity_spec> auto cross(const Q1& q1, const Q2& q2)
+{
+  return make_quantity<Q1::reference * Q2::reference>(
+    cross(q1.numerical_value_ref_in(q1.unit), q2.numerical_value_ref_in(q2.unit)));
+}
+
+/**
+ * @brief Computes the magnitude of a vector quantity
+ *
+ * @tparam QS the scalar quantity specification of the result (e.g. `isq::speed` for a velocity)
+ */
+template<QuantitySpec auto QS, QuantityOf<QS> Q>
+  requires is_vector<typename Q::rep> && (QS.character == quantity_character::scalar) &&
+           requires(const Q::rep& v) { norm(v); }
+[[nodiscard]] QuantityOf<QS> auto get_magnitude(const Q& q)
+{
+  return make_quantity<QS[Q::unit]>(norm(q.numerical_value_ref_in(q.unit)));
+}
+
+}  // namespace mp_units
+
+template<typename T, typename U, std::size_t N>
+struct std::common_type<mp_units::vec<T, N>, mp_units::vec<U, N>> {
+  using type = mp_units::vec<std::common_type_t<T, U>, N>;
+};
@@ -0,0 +1,99 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/batch.h>
+#include <mp-units/quantity_point.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/isq/thermodynamics.h>
+#include <mp-units/systems/si/point_origins.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <mp-units/systems/si/units.h>
+#include <array>
+#include <span>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+TEST_CASE("batched 'point_for' matches the per-element conversion", "[batch][point_for]")
+{
+  SECTION("origin change only")
+  {
+    const std::vector<quantity_point<si::kelvin, si::ice_point>> from = {
+      si::ice_point + -273.15 * K, si::ice_point + 0. * K, si::ice_point + 21.5 * K};
+    std::vector<quantity_point<si::kelvin, si::absolute_zero>> to(from.size());
+
+    point_for<si::absolute_zero>(from, to);
+
+    for (std::size_t i = 0; i < from.size(); ++i) CHECK(to[i] == from[i].point_for(si::absolute_zero));
+  }
+
+  SECTION("origin and unit change folded together")
+  {
+    const std::vector<quantity_point<isq::thermodynamic_temperature[mK], si::ice_point>> from = {
+      si::ice_point + isq::thermodynamic_temperature(-1000. * mK),
+      si::ice_point + isq::thermodynamic_temperature(42'500. * mK)};
+    std::vector<quantity_point<isq::thermodynamic_temperature[K], si::absolute_zero>> to(from.size());
+
+    point_for<si::absolute_zero>(from, to);
+
+    CHECK(to[0].quantity_ref_from(si::absolute_zero).numerical_value_in(K) == 272.15);
+    CHECK(to[1].quantity_ref_from(si::absolute_zero).numerical_value_in(K) == 315.65);
+  }
+
+  SECTION("integral representation without an origin offset")
+  {
+    constexpr auto origin = si::absolute_zero;
+    const std::array from = {origin + 1 * K, origin + 2 * K};
+    std::array<quantity_point<si::milli<si::kelvin>, origin, int>, 2> to{};
+
+    point_for<origin>(std::span{from}, std::span{to});
+
+    CHECK(to[0] == origin + 1000 * mK);
+    CHECK(to[1] == origin + 2000 * mK);
+  }
+}
+
+TEST_CASE("batched 'in' matches the per-element conversion", "[batch][in]")
+{
+  SECTION("quantities")
+  {
+    const std::vector<quantity<isq::length[km], int>> from = {1 * isq::length[km], -3 * isq::length[km]};
+    std::vector<quantity<isq::length[m], int>> to(from.size());
+
+    in<m>(from, to);
+
+    CHECK(to[0] == 1000 * isq::length[m]);
+    CHECK(to[1] == -3000 * isq::length[m]);
+  }
+
+  SECTION("quantity points keep their origin")
+  {
+    const std::vector<quantity_point<si::kelvin, si::ice_point>> from = {si::ice_point + 1.5 * K};
+    std::vector<quantity_point<si::milli<si::kelvin>, si::ice_point>> to(from.size());
+
+    in<mK>(from, to);
+
+    CHECK(to[0] == from[0].in(mK));
+  }
+}
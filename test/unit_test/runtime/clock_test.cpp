@@ -0,0 +1,75 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/clock.h>
+#include <mp-units/histogram.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cstdint>
+#include <type_traits>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(
+  std::is_same_v<quantity_clock<>::time_point,
+                 quantity_point<isq::time[ns], chrono_point_origin<std::chrono::steady_clock>, std::int64_t>>);
+static_assert(std::is_same_v<quantity_clock<tsc_clock>::duration, quantity<isq::time[ns], std::int64_t>>);
+
+TEST_CASE("'quantity_clock' is monotonic for steady clocks", "[clock]")
+{
+  SECTION("steady_clock")
+  {
+    const auto t1 = quantity_clock<>::now();
+    const auto t2 = quantity_clock<>::now();
+    CHECK(t2 >= t1);
+  }
+
+  SECTION("tsc_clock")
+  {
+    const auto t1 = quantity_clock<tsc_clock>::now();
+    const auto t2 = quantity_clock<tsc_clock>::now();
+    CHECK(t2 >= t1);
+    CHECK(tsc_clock::now().time_since_epoch() >= tsc_clock::duration::zero());
+    CHECK(tsc_clock::frequency() > 0 * isq::frequency[Hz]);
+  }
+}
+
+TEST_CASE("'quantity_clock' time points convert to 'std::chrono'", "[clock]")
+{
+  const auto qp = quantity_clock<std::chrono::system_clock>::now();
+  const std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds> tp = to_chrono_time_point(qp);
+  CHECK(tp.time_since_epoch().count() == qp.quantity_ref_from(qp.point_origin).numerical_value_in(ns));
+}
+
+TEST_CASE("'scoped_timer' records the scope duration", "[clock][scoped_timer]")
+{
+  quantity_histogram<quantity_clock<>::duration> latency;
+  {
+    scoped_timer timer(latency);
+    CHECK(timer.elapsed() >= 0 * ns);
+  }
+  {
+    scoped_timer<quantity_clock<tsc_clock>> timer(latency);
+  }
+  CHECK(latency.count() == 2);
+}
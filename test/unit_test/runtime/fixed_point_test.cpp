@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/fixed_point.h>
+#include <mp-units/ostream.h>
+#include <mp-units/systems/iec80000/iec80000.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+using q16 = fixed_point<std::int32_t, 16>;
+using uq8 = fixed_point<std::uint16_t, 8>;
+
+static_assert(RepresentationOf<q16, quantity_character::scalar>);
+static_assert(RepresentationOf<uq8, quantity_character::scalar>);
+static_assert(!treat_as_floating_point<q16>);
+static_assert(sizeof(q16) == sizeof(std::int32_t));
+// only the integers fitting in the integral part have a common type with a fixed-point number
+template<typename T, typename U>
+concept have_common_type = requires { typename std::common_type_t<T, U>; };
+static_assert(std::is_same_v<std::common_type_t<q16, std::int16_t>, q16>);
+static_assert(std::is_same_v<std::common_type_t<std::int8_t, q16>, q16>);
+static_assert(std::is_same_v<std::common_type_t<uq8, std::uint8_t>, uq8>);
+static_assert(!have_common_type<q16, std::uint16_t>);
+static_assert(!have_common_type<q16, int>);
+static_assert(!have_common_type<std::int64_t, q16>);
+
+static_assert(q16{3}.raw() == 3 << 16);
+static_assert(q16{0.5}.raw() == 1 << 15);
+static_assert(q16::from_raw(1).raw() == 1);
+static_assert(quantity_values<q16>::max().raw() == std::numeric_limits<std::int32_t>::max());
+static_assert(quantity<si::metre, q16>::zero().numerical_value_in(m) == q16{});
+
+// a conversion to a coarser unit may lose the fractional bits (and a conversion to a finer one may overflow)
+static_assert(std::convertible_to<quantity<km, q16>, quantity<m, q16>>);
+static_assert(!std::convertible_to<quantity<m, q16>, quantity<km, q16>>);
+
+}  // namespace
+
+TEST_CASE("fixed_point arithmetic", "[fixed_point]")
+{
+  CHECK(q16{1.5} + q16{2} == q16{3.5});
+  CHECK(q16{1.5} - q16{2} == q16{-0.5});
+  CHECK(-q16{1.25} == q16{-1.25});
+  CHECK(q16{1.5} * q16{-2.25} == q16{-3.375});
+  CHECK(q16{-3.375} / q16{1.5} == q16{-2.25});
+  CHECK(q16{1.5} * 3 == q16{4.5});
+  CHECK(q16{4.5} / 3 == q16{1.5});
+  CHECK(q16{-13} >> 3 == q16{-1.625});
+  CHECK(q16{-13} << 2 == q16{-52});
+  CHECK(q16{1} < q16{1.5});
+  CHECK(static_cast<int>(q16{-2.75}) == -2);
+  CHECK(static_cast<double>(q16{-2.75}) == -2.75);
+  CHECK(static_cast<uq8>(q16{2.75}) == uq8{2.75});
+
+  // the quotients are truncated towards zero
+  CHECK(q16::from_raw(-3) / 2 == q16::from_raw(-1));
+  CHECK(q16::from_raw(-3) >> 1 == q16::from_raw(-1));
+}
+
+TEST_CASE("fixed_point quantities", "[fixed_point]")
+{
+  using namespace mp_units::iec80000::unit_symbols;
+  using mp_units::iec80000::bit;
+
+  SECTION("binary prefixes")
+  {
+    CHECK(quantity<bit, q16>(q16{3} * B).numerical_value_in(bit) == q16{24});
+    CHECK(value_cast<B>(q16{-13} * bit).numerical_value_in(B) == q16{-1.625});
+    CHECK(value_cast<KiB>(q16{512} * B).numerical_value_in(KiB) == q16{0.5});
+    CHECK(value_cast<bit>(q16{0.5} * KiB).numerical_value_in(bit) == q16{4096});
+  }
+
+  SECTION("decimal prefixes")
+  {
+    CHECK(quantity<m, q16>(q16{1.25} * km).numerical_value_in(m) == q16{1250});
+    CHECK(value_cast<km>(q16{1500} * m).numerical_value_in(km) == q16{1.5});
+  }
+
+  SECTION("quantity arithmetic")
+  {
+    const quantity v = q16{10} * isq::length[m] / (q16{4} * isq::time[s]);
+    CHECK(v.numerical_value_in(m / s) == q16{2.5});
+    CHECK((q16{1} * m + q16{0.5} * km).numerical_value_in(m) == q16{501});
+  }
+}
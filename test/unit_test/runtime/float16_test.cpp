@@ -0,0 +1,142 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/float16.h>
+#include <mp-units/format.h>
+#include <mp-units/ostream.h>
+#include <mp-units/systems/si/si.h>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(RepresentationOf<float16, quantity_character::scalar>);
+static_assert(RepresentationOf<bfloat16, quantity_character::scalar>);
+static_assert(treat_as_floating_point<float16>);
+static_assert(treat_as_floating_point<bfloat16>);
+static_assert(sizeof(quantity<si::metre, float16>) == 2);
+static_assert(sizeof(quantity<si::metre, bfloat16>) == 2);
+static_assert(detail::NarrowFloatingPoint<float16>);
+static_assert(detail::NarrowFloatingPoint<bfloat16>);
+static_assert(!detail::NarrowFloatingPoint<float>);
+
+// like for `std::float16_t` and `std::bfloat16_t` there is no common type of the two formats
+template<typename T, typename U>
+concept have_common_type = requires { typename std::common_type_t<T, U>; };
+static_assert(!have_common_type<float16, bfloat16>);
+
+#if !defined(__STDCPP_FLOAT16_T__) && !defined(__STDCPP_BFLOAT16_T__)
+// the arithmetic of the portable types promotes to `float`
+static_assert(std::is_same_v<decltype(float16{} + float16{}), float>);
+static_assert(std::is_same_v<decltype(float16{} * bfloat16{}), float>);
+static_assert(std::is_same_v<decltype(quantity<si::metre, float16>{} + quantity<si::metre, float16>{})::rep, float>);
+static_assert(std::is_same_v<std::common_type_t<float16, int>, float>);
+static_assert(std::is_same_v<std::common_type_t<float16, double>, double>);
+#endif
+
+// the conversions to finer units are implicit
+static_assert(std::convertible_to<quantity<km, float16>, quantity<m, float16>>);
+static_assert(std::convertible_to<quantity<m, float16>, quantity<km, float16>>);
+static_assert(std::convertible_to<quantity<m, float16>, quantity<m, float>>);
+
+}  // namespace
+
+TEST_CASE("16-bit floating-point types", "[float16]")
+{
+  SECTION("round trip of all the values")
+  {
+    for (std::uint32_t i = 0; i <= 0xFFFF; ++i) {
+      const auto bits = static_cast<std::uint16_t>(i);
+      const float h = std::bit_cast<float16>(bits);
+      if (!std::isnan(h)) REQUIRE(std::bit_cast<std::uint16_t>(float16(h)) == bits);
+      const float b = std::bit_cast<bfloat16>(bits);
+      if (!std::isnan(b)) REQUIRE(std::bit_cast<std::uint16_t>(bfloat16(b)) == bits);
+      // bfloat16 is the upper half of a float
+      REQUIRE(std::bit_cast<std::uint32_t>(b) == std::uint32_t{bits} << 16);
+    }
+  }
+
+  SECTION("rounding")
+  {
+    CHECK(float(float16(0.1)) == 0.0999755859375f);
+    CHECK(float(float16(1. + 0x1p-11)) == 1.f);                 // a tie rounds to even
+    CHECK(float(float16(1. + 3 * 0x1p-11)) == 1.f + 0x1p-9f);   // a tie rounds to even
+    CHECK(float(float16(65504.)) == 65504.f);
+    CHECK(std::isinf(float(float16(65520.))));
+    CHECK(float(float16(0x1p-24)) == 0x1p-24f);
+    CHECK(float(float16(0x1p-26)) == 0.f);
+    CHECK(float(bfloat16(3.14159)) == 3.140625f);
+    CHECK(float(bfloat16(1e38)) == 0x1.2cp+126f);
+  }
+
+  SECTION("limits")
+  {
+    using lim16 = std::numeric_limits<float16>;
+    using limb16 = std::numeric_limits<bfloat16>;
+    CHECK(float(lim16::epsilon()) == 0x1p-10f);
+    CHECK(float(lim16::max()) == 65504.f);
+    CHECK(float(lim16::lowest()) == -65504.f);
+    CHECK(float(lim16::min()) == 0x1p-14f);
+    CHECK(float(lim16::denorm_min()) == 0x1p-24f);
+    CHECK(float(limb16::epsilon()) == 0x1p-7f);
+    CHECK(float(limb16::min()) == std::numeric_limits<float>::min());
+    CHECK(std::isnan(float(limb16::quiet_NaN())));
+  }
+}
+
+TEST_CASE("16-bit floating-point quantities", "[float16]")
+{
+  SECTION("unit conversions")
+  {
+    const quantity<m, float16> q = float16(1.5) * km;
+    CHECK(q.numerical_value_in(m) == float16(1500));
+    CHECK(value_cast<bfloat16>(float16(1.001) * km).numerical_value_in(km) == bfloat16(1.));
+  }
+
+  SECTION("arithmetic")
+  {
+    quantity<m, float16> q = float16(1500) * m;
+    q += 2 * m;
+    CHECK(q.numerical_value_in(m) == float16(1502));
+    CHECK((q + q).numerical_value_in(m) == 3004);
+    CHECK((q / (float16(2) * s)).numerical_value_in(m / s) == 751);
+  }
+
+  SECTION("text output")
+  {
+    const quantity q = float16(1.5) * km;
+    std::ostringstream os;
+    os << q;
+    CHECK(os.str() == "1.5 km");
+    CHECK(MP_UNITS_STD_FMT::format("{}", q) == "1.5 km");
+    CHECK(MP_UNITS_STD_FMT::format("{:%.2Q %q}", q) == "1.50 km");
+    CHECK(MP_UNITS_STD_FMT::format("{:%.3Q}", bfloat16(3.14159) * m) == "3.141");
+  }
+}
@@ -0,0 +1,299 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "geographic.h"
+#include "glide_computer_lib.h"
+#include "spatial_index.h"
+#include "terrain_grid.h"
+#include "thread_pool.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using namespace geographic;
+using namespace geographic::literals;
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+// elevations of 2 rows of 3 samples spaced by 1 degree starting at 50N 10E
+terrain_grid make_terrain()
+{
+  return terrain_grid(position<long double>{50._N, 10._E}, 1. * deg, 2, 3, {0.f, 10.f, 20.f, 100.f, 110.f, 120.f});
+}
+
+double elevation_in_m(const terrain_grid& terrain, position<long double> pos)
+{
+  return terrain.elevation(pos).quantity_from(mean_sea_level).numerical_value_in(m);
+}
+
+void write_terrain_file(const std::filesystem::path& path, const terrain_grid::file_header& header)
+{
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  const std::vector<float> elevations(6);
+  file.write(reinterpret_cast<const char*>(elevations.data()),
+             static_cast<std::streamsize>(elevations.size() * sizeof(float)));
+}
+
+}  // namespace
+
+TEST_CASE("terrain_grid", "[geographic][terrain_grid]")
+{
+  const terrain_grid terrain = make_terrain();
+
+  SECTION("lookup")
+  {
+    CHECK_THAT(elevation_in_m(terrain, {50._N, 10._E}), WithinAbs(0., 1e-9));
+    CHECK_THAT(elevation_in_m(terrain, {51._N, 12._E}), WithinAbs(120., 1e-9));
+    CHECK_THAT(elevation_in_m(terrain, {50.5_N, 10.5_E}), WithinAbs(55., 1e-9));
+    CHECK_THAT(elevation_in_m(terrain, {50.25_N, 11.5_E}), WithinAbs(40., 1e-9));
+  }
+
+  SECTION("positions outside of the grid take the elevation of its nearest edge")
+  {
+    CHECK_THAT(elevation_in_m(terrain, {40._N, 5._E}), WithinAbs(0., 1e-9));
+    CHECK_THAT(elevation_in_m(terrain, {60._N, 20._E}), WithinAbs(120., 1e-9));
+    CHECK_THAT(elevation_in_m(terrain, {55._N, 10.5_E}), WithinAbs(105., 1e-9));
+  }
+
+  SECTION("save and load")
+  {
+    const auto path = std::filesystem::temp_directory_path() / "mp_units_terrain_grid_test.bin";
+    terrain.save(path);
+    {
+      const terrain_grid loaded = terrain_grid::load(path);
+      CHECK(loaded.rows() == 2);
+      CHECK(loaded.columns() == 3);
+      for (const auto& pos : {position<long double>{50.5_N, 10.5_E}, position<long double>{50.75_N, 11.25_E},
+                              position<long double>{51._N, 12._E}})
+        CHECK(elevation_in_m(loaded, pos) == elevation_in_m(terrain, pos));
+    }
+    std::filesystem::remove(path);
+  }
+
+  SECTION("invalid files are rejected")
+  {
+    const auto path = std::filesystem::temp_directory_path() / "mp_units_terrain_grid_invalid_test.bin";
+    const terrain_grid::file_header valid = {terrain_grid::magic, 2, 3, 50., 10., 1.};
+    write_terrain_file(path, valid);
+    CHECK_NOTHROW(terrain_grid::load(path));
+
+    auto header = valid;
+    header.magic[0] = 'X';
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    header = valid;
+    header.rows = 0;
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    header = valid;
+    header.columns = 0;
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    header = valid;
+    header.spacing = 0.;
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    header = valid;
+    header.spacing = std::numeric_limits<double>::quiet_NaN();
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    header = valid;
+    header.rows = 3;
+    write_terrain_file(path, header);
+    CHECK_THROWS_AS(terrain_grid::load(path), std::runtime_error);
+
+    std::filesystem::remove(path);
+  }
+
+  SECTION("ground level along a task")
+  {
+    using namespace glide_computer;
+    const task t = {waypoint{"A", {50._N, 10._E}, mean_sea_level + 0. * m},
+                    waypoint{"B", {51._N, 12._E}, mean_sea_level + 120. * m}};
+    const auto level_in_m = [&](distance dist) {
+      const flight_point pos{timestamp{}, mean_sea_level + 1000. * m, t.get_leg_index(dist), dist};
+      return terrain_level_alt(t, pos, terrain).quantity_from(mean_sea_level).numerical_value_in(m);
+    };
+    CHECK_THAT(level_in_m(distance::zero()), WithinAbs(0., 1e-6));
+    CHECK_THAT(level_in_m(t.get_distance()), WithinAbs(120., 1e-6));
+  }
+}
+
+TEST_CASE("batched spherical_distance matches the scalar one", "[geographic][spherical_distance]")
+{
+  const std::vector<position<long double>> from = {{54.24772_N, 18.6745_E},
+                                                   {53.52442_N, 18.84947_E},
+                                                   {0._N, 0._E},
+                                                   {45._S, 170._W},
+                                                   {89.5_N, 45._E},
+                                                   {33.9425_N, 118.408_W}};
+  const std::vector<position<long double>> to = {{53.52442_N, 18.84947_E},
+                                                 {54.24772_N, 18.6745_E},
+                                                 {10._S, 20._W},
+                                                 {44._S, 179._E},
+                                                 {89.5_N, 135._W},
+                                                 {40.6397_N, 73.7789_W}};
+  std::vector<distance> result(from.size());
+
+  SECTION("corresponding elements")
+  {
+    spherical_distance(from, to, result);
+    for (std::size_t i = 0; i < from.size(); ++i)
+      CHECK_THAT(result[i].numerical_value_in(km),
+                 WithinAbs(spherical_distance(from[i], to[i]).numerical_value_in(km), 1e-6));
+  }
+
+  SECTION("one to many")
+  {
+    spherical_distance(from[0], to, result);
+    for (std::size_t i = 0; i < to.size(); ++i)
+      CHECK_THAT(result[i].numerical_value_in(km),
+                 WithinAbs(spherical_distance(from[0], to[i]).numerical_value_in(km), 1e-6));
+  }
+
+  SECTION("one to many cached")
+  {
+    const spherical_points points(to);
+    REQUIRE(points.size() == to.size());
+    spherical_distance(from[0], points, result);
+    for (std::size_t i = 0; i < to.size(); ++i)
+      CHECK_THAT(result[i].numerical_value_in(km),
+                 WithinAbs(spherical_distance(from[0], to[i]).numerical_value_in(km), 1e-6));
+  }
+}
+
+namespace {
+
+std::vector<position<double>> random_positions(std::size_t count)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> lat(-90., 90.);
+  std::uniform_real_distribution<double> lon(-180., 180.);
+  std::vector<position<double>> res;
+  res.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+    res.push_back({equator + ranged_representation<double, -90, 90>{lat(gen)} * deg,
+                   prime_meridian + ranged_representation<double, -180, 180>{lon(gen)} * deg});
+  return res;
+}
+
+// the brute-force reference: all the positions ordered by the increasing distance from `center`
+std::vector<spatial_index::neighbour> sorted_by_distance(const std::vector<position<double>>& positions,
+                                                         const position<double>& center)
+{
+  std::vector<distance> dists(positions.size());
+  spherical_distance(center, positions, dists);
+  std::vector<spatial_index::neighbour> res;
+  res.reserve(positions.size());
+  for (std::size_t i = 0; i < positions.size(); ++i) res.push_back({i, dists[i]});
+  std::ranges::sort(res, {}, &spatial_index::neighbour::dist);
+  return res;
+}
+
+void check_same(const std::vector<spatial_index::neighbour>& found,
+                const std::vector<spatial_index::neighbour>& expected)
+{
+  REQUIRE(found.size() == expected.size());
+  for (std::size_t i = 0; i < found.size(); ++i) {
+    CHECK(found[i].index == expected[i].index);
+    CHECK_THAT(found[i].dist.numerical_value_in(km), WithinAbs(expected[i].dist.numerical_value_in(km), 1e-6));
+  }
+}
+
+}  // namespace
+
+TEST_CASE("spatial_index matches a brute-force scan", "[geographic][spatial_index]")
+{
+  const std::vector<position<double>> positions = random_positions(2000);
+  const std::vector<position<double>> centers = random_positions(20);
+  thread_pool pool(4);
+  const spatial_index serial(positions);
+  const spatial_index parallel(positions, pool);
+  REQUIRE(serial.size() == positions.size());
+  REQUIRE(parallel.size() == positions.size());
+
+  for (const auto& center : centers) {
+    const auto expected = sorted_by_distance(positions, center);
+
+    for (const distance radius : {0. * km, 500. * km, 2000. * km, 30'000. * km}) {
+      const auto last = std::ranges::upper_bound(expected, radius, {}, &spatial_index::neighbour::dist);
+      const std::vector<spatial_index::neighbour> in_range(expected.begin(), last);
+      check_same(serial.within(center, radius), in_range);
+      check_same(parallel.within(center, radius), in_range);
+    }
+
+    for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{10}, positions.size() + 1}) {
+      const std::vector<spatial_index::neighbour> closest(
+        expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(std::min(count, expected.size())));
+      check_same(serial.nearest(center, count), closest);
+      check_same(parallel.nearest(center, count), closest);
+    }
+  }
+}
+
+TEST_CASE("waypoint_database finds the nearby waypoints", "[geographic][spatial_index]")
+{
+  using namespace glide_computer;
+  const waypoint_database db({waypoint{"EPPR", {54.24772_N, 18.6745_E}, mean_sea_level + 16. * m},
+                              waypoint{"EPGI", {53.52442_N, 18.84947_E}, mean_sea_level + 115. * m},
+                              waypoint{"EPWA", {52.16569_N, 20.96712_E}, mean_sea_level + 110. * m}});
+
+  const auto nearby = db.within({54.24772_N, 18.6745_E}, 100. * km);
+  REQUIRE(nearby.size() == 2);
+  CHECK(nearby[0].wpt->name == "EPPR");
+  CHECK(nearby[1].wpt->name == "EPGI");
+
+  const auto closest = db.nearest({52._N, 21._E}, 1);
+  REQUIRE(closest.size() == 1);
+  CHECK(closest[0].wpt->name == "EPWA");
+}
+
+TEST_CASE("ranged_representation operations proven to stay in range", "[geographic][ranged_representation]")
+{
+  const auto check = []<typename Policy>(Policy) {
+    using rep = ranged_representation<double, -90, 90, Policy>;
+    CHECK(midpoint(rep(80.), rep(-20.)).value() == 30.);
+    CHECK(midpoint(rep(90.), rep(90.)).value() == 90.);
+    CHECK((-rep(90.)).value() == -90.);
+  };
+
+  SECTION("check_always") { check(check_always{}); }
+  SECTION("check_unproven") { check(check_unproven{}); }
+}
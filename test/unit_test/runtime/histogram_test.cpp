@@ -0,0 +1,105 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/histogram.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+namespace {
+
+using latency = quantity<si::micro<si::second>, std::int64_t>;
+using histogram = quantity_histogram<latency>;
+
+// values below 2^PrecisionBits are exact
+static_assert(histogram::bucket_index(0 * us) == 0);
+static_assert(histogram::bucket_index(127 * us) == 127);
+static_assert(histogram::bucket_lower_bound(127) == 127 * us);
+static_assert(histogram::bucket_upper_bound(127) == 127 * us);
+
+// then every power-of-two range is split into 64 buckets
+static_assert(histogram::bucket_index(128 * us) == 128);
+static_assert(histogram::bucket_index(129 * us) == 128);
+static_assert(histogram::bucket_lower_bound(128) == 128 * us);
+static_assert(histogram::bucket_upper_bound(128) == 129 * us);
+static_assert(histogram::bucket_index(256 * us) == 192);
+static_assert(histogram::bucket_upper_bound(192) == 259 * us);
+
+// the whole range of the representation type is covered
+static_assert(histogram::bucket_index(latency::max()) == histogram::bucket_count - 1);
+static_assert(histogram::bucket_upper_bound(histogram::bucket_count - 1) == latency::max());
+
+}  // namespace
+
+TEST_CASE("'quantity_histogram' counts recorded values", "[histogram]")
+{
+  histogram h;
+  CHECK(h.count() == 0);
+  CHECK(h.percentile(99) == 0 * us);
+
+  h.record(1 * us);
+  h.record(1 * ms);
+  h.record(2 * us, 3);
+  CHECK(h.count() == 5);
+
+  h.reset();
+  CHECK(h.count() == 0);
+}
+
+TEST_CASE("'quantity_histogram' percentiles are bounded by the bucket precision", "[histogram][percentile]")
+{
+  histogram h;
+  for (std::int64_t i = 1; i <= 1000; ++i) h.record(i * us);
+
+  CHECK(h.percentile(0) == 1 * us);
+  CHECK(h.percentile(10) == 100 * us);
+
+  const auto p99 = h.percentile(99);
+  CHECK(p99 >= 990 * us);
+  CHECK(p99 < 990 * us + 990 * us / 64);
+
+  const auto p100 = h.percentile(100);
+  CHECK(p100 >= 1000 * us);
+  CHECK(p100 < 1000 * us + 1000 * us / 64);
+}
+
+TEST_CASE("'quantity_histogram' snapshots are mergeable", "[histogram][snapshot]")
+{
+  histogram h1;
+  histogram h2;
+  h1.record(10 * us, 99);
+  h2.record(100 * us);
+
+  const auto merged = h1.snapshot() + h2.snapshot();
+  CHECK(merged.count() == 100);
+  CHECK(merged.percentile(99) == 10 * us);
+  CHECK(merged.percentile(99.9) == 100 * us);
+
+  h1.merge(h2.snapshot());
+  CHECK(h1.count() == 100);
+  CHECK(h1.percentile(100) == 100 * us);
+}
@@ -0,0 +1,114 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/kalman.h>
+#include <mp-units/systems/si/si.h>
+#include <concepts>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::kalman;
+using namespace mp_units::si::unit_symbols;
+
+using position = quantity<m>;
+using velocity = quantity<m / s>;
+using acceleration = quantity<m / s2>;
+
+// every element of the covariance is a quantity of the product of the references of its row and column
+using cov2 = covariance<position, velocity>;
+static_assert(cov2::size == 2);
+static_assert(std::same_as<cov2::element_type<0, 0>, quantity<m * m>>);
+static_assert(std::same_as<cov2::element_type<0, 1>, quantity<m * (m / s)>>);
+static_assert(std::same_as<cov2::element_type<1, 0>, quantity<(m / s) * m>>);
+static_assert(std::same_as<cov2::element_type<1, 1>, quantity<(m / s) * (m / s)>>);
+static_assert(std::same_as<decltype(get<0, 1>(cov2{})), cov2::element_type<0, 1>>);
+static_assert(sizeof(cov2) == 4 * sizeof(double));
+
+constexpr cov2 make_covariance(double p00, double p01, double p11)
+{
+  cov2 p{p00 * (m * m), p11 * ((m / s) * (m / s))};
+  set<0, 1>(p, p01 * (m * (m / s)));
+  set<1, 0>(p, p01 * ((m / s) * m));
+  return p;
+}
+
+// F * P * F^T + Q for F = [[1, 2 s], [0, 1]]:
+// F * P = [[4 + 2 * 0.5, 0.5 + 2 * 1], [0.5, 1]] and F * P * F^T = [[5 + 2 * 2.5, 2.5], [0.5 + 2 * 1, 1]]
+constexpr cov2 extrapolated =
+  covariance_extrapolation(make_covariance(4., 0.5, 1.), 2. * s, make_covariance(0.25, 0., 0.125));
+static_assert(get<0, 0>(extrapolated) == 10.25 * (m * m));
+static_assert(get<0, 1>(extrapolated) == 2.5 * (m * (m / s)));
+static_assert(get<1, 0>(extrapolated) == 2.5 * ((m / s) * m));
+static_assert(get<1, 1>(extrapolated) == 1.125 * ((m / s) * (m / s)));
+
+}  // namespace
+
+TEST_CASE("kalman covariance extrapolation of a constant acceleration model", "[kalman]")
+{
+  // F = [[1, dt, dt^2 / 2], [0, 1, dt], [0, 0, 1]] with dt = 1 s and P = I gives F * F^T
+  const covariance<position, velocity, acceleration> p{1. * (m * m),
+                                                       1. * ((m / s) * (m / s)),
+                                                       1. * ((m / s2) * (m / s2))};
+  const covariance<position, velocity, acceleration> q{};
+  const auto res = covariance_extrapolation(p, 1. * s, q);
+
+  CHECK(get<0, 0>(res).numerical_value_in(m * m) == 2.25);
+  CHECK(get<0, 1>(res).numerical_value_in(m * m / s) == 1.5);
+  CHECK(get<0, 2>(res).numerical_value_in(m * m / s2) == 0.5);
+  CHECK(get<1, 0>(res).numerical_value_in(m * m / s) == 1.5);
+  CHECK(get<1, 1>(res).numerical_value_in(m * m / s2) == 2.);
+  CHECK(get<1, 2>(res).numerical_value_in(m * m / (s2 * s)) == 1.);
+  CHECK(get<2, 0>(res).numerical_value_in(m * m / s2) == 0.5);
+  CHECK(get<2, 1>(res).numerical_value_in(m * m / (s2 * s)) == 1.);
+  CHECK(get<2, 2>(res).numerical_value_in(m * m / (s2 * s2)) == 1.);
+}
+
+TEST_CASE("kalman predict and update", "[kalman]")
+{
+  const estimation current{state{position{100. * m}, velocity{10. * (m / s)}}, make_covariance(4., 2., 3.)};
+
+  SECTION("predict")
+  {
+    const auto predicted = predict(current, 2. * s, cov2{});
+    CHECK(get<0>(predicted.state) == position{120. * m});
+    CHECK(get<1>(predicted.state) == velocity{10. * (m / s)});
+    // [[4 + 2 * 2 + 2 * (2 + 2 * 3), 2 + 2 * 3], [2 + 2 * 3, 3]]
+    CHECK(get<0, 0>(predicted.uncertainty).numerical_value_in(m * m) == 24.);
+    CHECK(get<0, 1>(predicted.uncertainty).numerical_value_in(m * m / s) == 8.);
+    CHECK(get<1, 1>(predicted.uncertainty).numerical_value_in(m * m / s2) == 3.);
+  }
+
+  SECTION("update")
+  {
+    // the innovation uncertainty is 4 m2 + 4 m2, so the gain is [0.5, 0.25 1/s]
+    const auto updated = update(current, position{108. * m}, 4. * (m * m));
+    CHECK(get<0>(updated.state) == position{104. * m});
+    CHECK(get<1>(updated.state) == velocity{12. * (m / s)});
+    // P - K * P(0, :)
+    CHECK(get<0, 0>(updated.uncertainty).numerical_value_in(m * m) == 2.);
+    CHECK(get<0, 1>(updated.uncertainty).numerical_value_in(m * m / s) == 1.);
+    CHECK(get<1, 0>(updated.uncertainty).numerical_value_in(m * m / s) == 1.);
+    CHECK(get<1, 1>(updated.uncertainty).numerical_value_in(m * m / s2) == 2.5);
+  }
+}
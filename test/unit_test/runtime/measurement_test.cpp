@@ -0,0 +1,172 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <mp-units/measurement.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <cmath>
+#include <sstream>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+using Catch::Matchers::WithinAbs;
+using Catch::Matchers::WithinRel;
+
+static_assert(RepresentationOf<measurement<double>, quantity_character::scalar>);
+static_assert(treat_as_floating_point<measurement<double>>);
+static_assert(!treat_as_floating_point<measurement<int>>);
+static_assert(measurement<double>{3., 2.}.variance() == 4.);
+static_assert((measurement<double>{1., 3.} + measurement<double>{2., 4.}).variance() == 25.);
+
+}  // namespace
+
+TEST_CASE("measurement uncertainty propagation", "[measurement]")
+{
+  const measurement<double> a{9.8, 0.1};
+  const measurement<double> b{1.2, 0.1};
+
+  SECTION("construction")
+  {
+    const measurement<double> m{5., -0.5};
+    CHECK(m.value() == 5.);
+    CHECK(m.uncertainty() == 0.5);
+    CHECK(m.lower_bound() == 4.5);
+    CHECK(m.upper_bound() == 5.5);
+    CHECK(m.relative_uncertainty() == 0.1);
+  }
+
+  SECTION("sum and difference")
+  {
+    CHECK_THAT((a + b).value(), WithinRel(11.));
+    CHECK_THAT((a + b).uncertainty(), WithinRel(std::hypot(0.1, 0.1)));
+    CHECK_THAT((a - b).value(), WithinRel(8.6));
+    CHECK_THAT((a - b).uncertainty(), WithinRel(std::hypot(0.1, 0.1)));
+  }
+
+  SECTION("product and quotient")
+  {
+    const double rel = std::hypot(a.relative_uncertainty(), b.relative_uncertainty());
+    CHECK_THAT((a * b).value(), WithinRel(11.76));
+    CHECK_THAT((a * b).uncertainty(), WithinRel(11.76 * rel));
+    CHECK_THAT((a / b).uncertainty(), WithinRel(9.8 / 1.2 * rel));
+  }
+
+  SECTION("scaling")
+  {
+    CHECK_THAT((a * 10.).uncertainty(), WithinRel(1.));
+    CHECK_THAT((-2. * a).uncertainty(), WithinRel(0.2));
+    CHECK_THAT((a / 2.).uncertainty(), WithinRel(0.05));
+    CHECK_THAT((1. / b).uncertainty(), WithinRel(0.1 / (1.2 * 1.2)));
+  }
+
+  SECTION("compound expression matches the chain of per-operation results")
+  {
+    measurement<double> r = a;
+    r *= b;
+    r += a;
+    r /= b;
+    const double u = ((a * b + a) / b).uncertainty();
+    CHECK_THAT(r.uncertainty(), WithinRel(u));
+  }
+
+  SECTION("correlated operands")
+  {
+    CHECK_THAT(sum(a, a, 1.).uncertainty(), WithinRel(0.2));
+    CHECK(difference(a, a, 1.).uncertainty() == 0.);
+    CHECK_THAT(difference(a, b, 0.).uncertainty(), WithinRel((a - b).uncertainty()));
+    CHECK_THAT(product(a, a, 1.).uncertainty(), WithinRel(2 * 9.8 * 0.1));
+    CHECK(quotient(a, a, 1.).uncertainty() == 0.);
+    CHECK_THAT(quotient(a, b, 0.).uncertainty(), WithinRel((a / b).uncertainty()));
+  }
+
+  SECTION("text output")
+  {
+    std::ostringstream os;
+    os << measurement<double>{123., 1.};
+    CHECK(os.str() == "123 ± 1");
+  }
+}
+
+TEST_CASE("measurement quantity", "[measurement]")
+{
+  const auto acceleration = isq::acceleration(measurement{9.8, 0.1} * m / s2);
+  const auto time = measurement{1.2, 0.1} * s;
+
+  SECTION("arithmetic")
+  {
+    const QuantityOf<isq::velocity> auto velocity = acceleration * time;
+    CHECK_THAT(velocity.numerical_value_in(m / s).value(), WithinRel(11.76));
+    CHECK_THAT(velocity.numerical_value_in(km / h).uncertainty(),
+               WithinRel(velocity.numerical_value_in(m / s).uncertainty() * 3.6));
+  }
+
+  SECTION("correlated operands")
+  {
+    const auto d1 = measurement{1., 0.01} * km;
+    const auto d2 = measurement{500., 10.} * m;
+    const quantity total = sum(d1, d2, 1.);
+    CHECK_THAT(total.numerical_value_in(m).value(), WithinRel(1500.));
+    CHECK_THAT(total.numerical_value_in(m).uncertainty(), WithinRel(20.));
+    CHECK_THAT(difference(d1, d2, 1.).numerical_value_in(m).uncertainty(), WithinAbs(0., 1e-6));
+    const QuantityOf<isq::length * isq::length> auto area = product(d1, d2, 0.);
+    CHECK_THAT(area.numerical_value_in(m * m).value(), WithinRel(500'000.));
+    const quantity ratio = quotient(d2, d1, 0.);
+    CHECK_THAT(ratio.numerical_value_in(one).value(), WithinRel(0.5));
+  }
+}
+
+TEST_CASE("measurement_vector", "[measurement]")
+{
+  measurement_vector<double> x;
+  measurement_vector<double> y;
+  x.reserve(3);
+  for (int i = 1; i <= 3; ++i) {
+    x.push_back(measurement<double>{1. * i, 0.1});
+    y.push_back(measurement<double>{2. * i, 0.2});
+  }
+  REQUIRE(x.size() == 3);
+
+  SECTION("element-wise operations match the scalar ones")
+  {
+    const auto s = x + y;
+    const auto d = x - y;
+    const auto p = x * y;
+    const auto q = x / y;
+    for (std::size_t i = 0; i < x.size(); ++i) {
+      CHECK(s[i] == x[i] + y[i]);
+      CHECK(d[i] == x[i] - y[i]);
+      CHECK(p[i] == x[i] * y[i]);
+      CHECK(q[i] == x[i] / y[i]);
+    }
+  }
+
+  SECTION("scaling")
+  {
+    const auto r = 2. * x;
+    CHECK(r.values()[2] == 6.);
+    CHECK_THAT(r.uncertainties()[2], WithinRel(0.2));
+  }
+}
@@ -0,0 +1,163 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "almost_equals.h"
+#include <catch2/catch_all.hpp>
+#include <mp-units/ostream.h>
+#include <mp-units/quantity_matrix.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <type_traits>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+inline constexpr auto pos = isq::length[m];
+inline constexpr auto spd = isq::speed[m / s];
+
+using state = references<pos, spd>;
+using covariance = quantity_matrix<state, state>;
+using transition = quantity_matrix<state, references<inverse(pos), inverse(spd)>>;
+
+static_assert(covariance::rows == 2 && covariance::columns == 2);
+static_assert(sizeof(covariance) == 4 * sizeof(double));
+static_assert(std::is_same_v<covariance::element_type<0, 1>, quantity<pos * spd>>);
+static_assert(std::is_same_v<transition::element_type<0, 1>::rep, double>);
+static_assert(transition::element_type<0, 1>::unit == s);
+
+// a dimensionless inner product does not change the references of the result
+static_assert(std::is_same_v<decltype(std::declval<transition>() * std::declval<covariance>() *
+                                      transpose(std::declval<transition>())),
+                             covariance>);
+static_assert(std::is_same_v<decltype(transpose(std::declval<transition>())),
+                             quantity_matrix<references<inverse(pos), inverse(spd)>, state>>);
+static_assert(std::is_same_v<decltype(inverse(std::declval<covariance>())),
+                             quantity_matrix<references<inverse(pos), inverse(spd)>,
+                                             references<inverse(pos), inverse(spd)>>>);
+
+// the units of the inner products have to agree
+template<typename A, typename B>
+concept multipliable = requires(const A& a, const B& b) { a * b; };
+static_assert(multipliable<transition, covariance>);
+static_assert(!multipliable<covariance, covariance>);
+static_assert(!multipliable<quantity_matrix<state, references<pos>>, covariance>);
+
+// integral matrices can't be inverted
+template<typename T>
+concept invertible = requires(const T& m) { inverse(m); };
+static_assert(invertible<covariance>);
+static_assert(!invertible<quantity_matrix<state, state, int>>);
+static_assert(!invertible<quantity_matrix<state, references<pos>>>);
+
+}  // namespace
+
+TEST_CASE("quantity_matrix", "[quantity_matrix]")
+{
+  covariance p = covariance::diagonal(4. * pos * pos, 1. * spd * spd);
+  set<0, 1>(p, 0.5 * pos * spd);
+  set<1, 0>(p, 0.5 * pos * spd);
+
+  SECTION("entries")
+  {
+    CHECK(get<0, 0>(p) == 4. * pos * pos);
+    CHECK(get<0, 1>(p) == 0.5 * pos * spd);
+    CHECK(get<1, 1>(p) == 1. * spd * spd);
+    CHECK(p.data()[1] == 0.5);
+  }
+
+  SECTION("conversion of units")
+  {
+    const quantity_matrix<references<isq::length[km], spd>, state> converted = p;
+    CHECK(get<0, 0>(converted) == 0.004 * isq::length[km] * pos);
+    CHECK(get<1, 1>(converted) == 1. * spd * spd);
+    CHECK(covariance(converted) == p);
+  }
+
+  SECTION("element-wise operations")
+  {
+    const covariance sum = p + p;
+    CHECK(sum == p * 2.);
+    CHECK(sum - p == p);
+    CHECK(-p + p == covariance{});
+    CHECK(sum / 2. == p);
+  }
+
+  SECTION("scaling by a quantity")
+  {
+    const auto scaled = p * (2. * isq::time[s]);
+    CHECK(get<0, 1>(scaled) == 1. * pos * spd * isq::time[s]);
+    CHECK(get<0, 1>(scaled).numerical_value_in(m * m) == 1.);
+  }
+
+  SECTION("multiplication")
+  {
+    transition f = transition::diagonal(1. * one, 1. * one);
+    set<0, 1>(f, 2. * s);
+    const covariance predicted = f * p * transpose(f);
+    CHECK(get<0, 0>(predicted) == 10. * pos * pos);
+    CHECK(get<0, 1>(predicted) == 2.5 * pos * spd);
+    CHECK(get<1, 0>(predicted) == 2.5 * pos * spd);
+    CHECK(get<1, 1>(predicted) == 1. * spd * spd);
+  }
+
+  SECTION("inversion")
+  {
+    const auto inv = inverse(p);
+    const auto identity = p * inv;
+    REQUIRE_THAT((get<0, 0>(identity)), AlmostEquals(1. * one));
+    REQUIRE_THAT((get<0, 1>(identity)), AlmostEquals(0. * pos / spd));
+    REQUIRE_THAT((get<1, 0>(identity)), AlmostEquals(0. * spd / pos));
+    REQUIRE_THAT((get<1, 1>(identity)), AlmostEquals(1. * one));
+  }
+
+  SECTION("inversion with pivoting")
+  {
+    using m3 = quantity_matrix<references<one, one, one>, references<one, one, one>>;
+    m3 m;
+    set<0, 1>(m, 1. * one);
+    set<1, 2>(m, 2. * one);
+    set<2, 0>(m, 4. * one);
+    const m3 inv = inverse(m);
+    CHECK(get<0, 2>(inv) == 0.25 * one);
+    CHECK(get<1, 0>(inv) == 1. * one);
+    CHECK(get<2, 1>(inv) == 0.5 * one);
+    CHECK(m * inv == m3::diagonal(1. * one, 1. * one, 1. * one));
+  }
+
+  SECTION("matrices larger than the unrolled ones")
+  {
+    using ones = references<one, one, one, one, one, one, one, one>;
+    using m8 = quantity_matrix<ones, ones>;
+    m8 m;
+    for (std::size_t i = 0; i < m8::rows; ++i) {
+      m.data()[i * m8::columns + i] = 1.;
+      if (i + 1 < m8::columns) m.data()[i * m8::columns + i + 1] = 1.;
+    }
+    const m8 inv = inverse(m);
+    for (std::size_t i = 0; i < m8::rows; ++i)
+      for (std::size_t j = 0; j < m8::columns; ++j)
+        CHECK(inv.data()[i * m8::columns + j] == (j < i ? 0. : ((j - i) % 2 == 0 ? 1. : -1.)));
+    CHECK(m * inv == m8::diagonal(1. * one, 1. * one, 1. * one, 1. * one, 1. * one, 1. * one, 1. * one, 1. * one));
+  }
+}
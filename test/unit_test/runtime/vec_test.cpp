@@ -0,0 +1,135 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <catch2/catch_test_macros.hpp>
+#include <mp-units/ostream.h>
+#include <mp-units/systems/isq/mechanics.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/si.h>
+#include <mp-units/vec.h>
+#include <type_traits>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(Representation<vec<int, 3>>);
+static_assert(RepresentationOf<vec<double, 3>, quantity_character::vector>);
+static_assert(!RepresentationOf<vec<double, 3>, quantity_character::scalar>);
+static_assert(treat_as_floating_point<vec<double, 3>>);
+static_assert(!treat_as_floating_point<vec<int, 3>>);
+static_assert(sizeof(vec<double, 3>) == 4 * sizeof(double));
+static_assert(alignof(vec<double, 3>) == 4 * sizeof(double));
+static_assert(sizeof(vec<float, 5>) == 8 * sizeof(float));
+static_assert(std::is_same_v<std::common_type_t<vec<int, 3>, vec<double, 3>>, vec<double, 3>>);
+
+}  // namespace
+
+TEST_CASE("vec representation", "[vec]")
+{
+  SECTION("element-wise operations")
+  {
+    const vec<int, 3> v{1, 2, 3};
+    const vec<int, 3> u{3, 2, 1};
+    CHECK(v + u == vec<int, 3>{4, 4, 4});
+    CHECK(v - u == vec<int, 3>{-2, 0, 2});
+    CHECK(-v == vec<int, 3>{-1, -2, -3});
+    CHECK(v * 2 == vec<int, 3>{2, 4, 6});
+    CHECK(0.5 * v == vec<double, 3>{0.5, 1., 1.5});
+    CHECK(vec<int, 3>{2, 4, 6} / 2 == v);
+  }
+
+  SECTION("compound division")
+  {
+    vec<double, 3> v{1., 2., 3.};
+    v /= 2.;
+    CHECK(v == vec<double, 3>{0.5, 1., 1.5});
+  }
+
+  SECTION("products")
+  {
+    const vec<int, 3> v{1, 2, 3};
+    const vec<int, 3> u{4, 5, 6};
+    CHECK(dot(v, u) == 32);
+    CHECK(cross(v, u) == vec<int, 3>{-3, 6, -3});
+    CHECK(norm(vec<double, 3>{2., 3., 6.}) == 7.);
+  }
+}
+
+TEST_CASE("vec quantity", "[vec]")
+{
+  SECTION("cast of unit")
+  {
+    SECTION("non-truncating")
+    {
+      const auto v = vec<int, 3>{3, 2, 1} * isq::position_vector[km];
+      CHECK(v.numerical_value_in(m) == vec<int, 3>{3000, 2000, 1000});
+    }
+
+    SECTION("truncating")
+    {
+      const auto v = vec<int, 3>{1001, 1002, 1003} * isq::position_vector[m];
+      CHECK(v.force_numerical_value_in(km) == vec<int, 3>{1, 1, 1});
+    }
+  }
+
+  SECTION("add and subtract in different units")
+  {
+    const auto v = vec<int, 3>{1, 2, 3} * isq::position_vector[m];
+    const auto u = vec<int, 3>{3, 2, 1} * isq::position_vector[km];
+    CHECK((v + u).numerical_value_in(m) == vec<int, 3>{3001, 2002, 1003});
+    CHECK((v - u).numerical_value_in(m) == vec<int, 3>{-2999, -1998, -997});
+  }
+
+  SECTION("multiply by scalar quantity")
+  {
+    const auto v = vec<int, 3>{1, 2, 3} * isq::velocity[m / s];
+    const quantity<isq::momentum[N * s], vec<int, 3>> momentum = 2 * isq::mass[kg] * v;
+    CHECK(momentum.numerical_value_in(N * s) == vec<int, 3>{2, 4, 6});
+  }
+
+  SECTION("magnitude")
+  {
+    const auto v = vec<int, 3>{2, 3, 6} * isq::velocity[km / h];
+    const quantity speed = get_magnitude<isq::speed>(v);
+    static_assert(QuantityOf<decltype(speed), isq::speed>);
+    CHECK(speed.numerical_value_in(km / h) == 7);
+  }
+
+  SECTION("scalar product")
+  {
+    const auto f = vec<double, 3>{1., 2., 3.} * isq::force[N];
+    const auto d = vec<double, 3>{4., 5., 6.} * isq::displacement[m];
+    const quantity w = dot<isq::work>(f, d);
+    static_assert(QuantityOf<decltype(w), isq::work>);
+    CHECK(w.numerical_value_in(J) == 32.);
+  }
+
+  SECTION("vector product")
+  {
+    const auto r = vec<double, 3>{1., 0., 0.} * isq::position_vector[m];
+    const auto f = vec<double, 3>{0., 2., 0.} * isq::force[N];
+    const quantity<isq::moment_of_force[N * m], vec<double, 3>> moment = cross(r, f);
+    CHECK(moment.numerical_value_in(N * m) == vec<double, 3>{0., 0., 2.});
+  }
+}
@@ -0,0 +1,80 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "test_tools.h"
+#include <mp-units/constant_quantity.h>
+#include <mp-units/quantity.h>
+#include <mp-units/systems/isq/space_and_time.h>
+#include <mp-units/systems/si/constants.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <type_traits>
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+inline constexpr constant_quantity<1, si::si2019::speed_of_light_in_vacuum> c;
+inline constexpr constant_quantity<2, isq::length[m]> two_metres;
+
+// no storage
+static_assert(std::is_empty_v<constant_quantity<1, si::si2019::speed_of_light_in_vacuum>>);
+static_assert(std::is_empty_v<constant_quantity<2, isq::length[m]>>);
+
+// member values
+static_assert(two_metres.value == 2);
+static_assert(is_of_type<two_metres.reference, reference<isq::length, si::metre>>);
+static_assert(is_of_type<two_metres.folded_reference, std::remove_const_t<decltype(isq::length[mag<2> * m])>>);
+static_assert(is_of_type<c.folded_reference, struct si::si2019::speed_of_light_in_vacuum>);
+
+// conversion to quantity
+static_assert(quantity<isq::length[m], int>(two_metres) == 2 * isq::length[m]);
+
+// arithmetic with quantities only changes the reference
+static_assert(is_of_type<2 * s * c, quantity<si::second * si::si2019::speed_of_light_in_vacuum, int>>);
+static_assert((2 * s * c).numerical_value_in((2 * s * c).unit) == 2);
+static_assert((2 * s * c).in(m).numerical_value_in(m) == 599'584'916);
+static_assert((c * (2 * s)).in(m).numerical_value_in(m) == 599'584'916);
+static_assert((3 * m * two_metres).numerical_value_in(m2) == 6);
+static_assert((6. * m2 / two_metres).numerical_value_in(m) == 3.);
+static_assert((299'792'458. * m / c).numerical_value_in(s) == 1.);
+
+// the value is folded in a division only for floating-point quantities; integral ones divide the value
+// and truncate like `2 * m / (4 * s)`
+static_assert((two_metres / (4. * s)).numerical_value_in(m / s) == 0.5);
+static_assert((two_metres / (1 * s)).numerical_value_in(m / s) == 2);
+static_assert((two_metres / (4 * s)).numerical_value_in(m / s) == (2 * m / (4 * s)).numerical_value_in(m / s));
+
+// arithmetic with numbers
+static_assert(QuantityOf<decltype(3 * two_metres), isq::length>);
+static_assert((3 * two_metres).numerical_value_in(m) == 6);
+static_assert((two_metres * 3).numerical_value_in(m) == 6);
+static_assert((4. / two_metres).numerical_value_in(one / m) == 2.);
+
+// arithmetic of constants yields constants
+static_assert(std::is_empty_v<decltype(two_metres * two_metres)>);
+static_assert((1 * (two_metres * two_metres)).numerical_value_in(m2) == 4);
+static_assert((1 * (two_metres / two_metres)).numerical_value_in(one) == 1);
+static_assert((1 * pow<2>(two_metres)).numerical_value_in(m2) == 4);
+static_assert((1LL * pow<2>(c)).in(m2 / s2).numerical_value_in(m2 / s2) == 299'792'458LL * 299'792'458LL);
+
+}  // namespace
@@ -91,6 +91,14 @@ static_assert(storage_capacity(1 * Tibit) == storage_capacity(1024 * Gibit));
 static_assert(storage_capacity(1 * Pibit) == storage_capacity(1024 * Tibit));
 static_assert(storage_capacity(1 * Eibit) == storage_capacity(1024 * Pibit));
 
+// conversions by powers of 2 truncate towards zero like the division
+static_assert(value_cast<B>(13 * bit).numerical_value_in(B) == 1);
+static_assert(value_cast<B>(-13 * bit).numerical_value_in(B) == -1);
+static_assert(value_cast<B>(-16 * bit).numerical_value_in(B) == -2);
+static_assert(value_cast<KiB>(-1023 * B).numerical_value_in(KiB) == 0);
+static_assert(value_cast<bit>(-3 * KiB).numerical_value_in(bit) == -24576);
+static_assert(value_cast<B>(255u * bit).numerical_value_in(B) == 31u);
+
 // transfer rate
 static_assert(storage_capacity(16 * B) / isq::duration(2 * s) == transfer_rate(8 * B / s));
 static_assert(storage_capacity(120 * kB) / isq::duration(2 * min) == transfer_rate(1000 * B / s));
@@ -0,0 +1,114 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <mp-units/quantity.h>
+#include <mp-units/systems/si/unit_symbols.h>
+#include <mp-units/systems/si/units.h>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+template<typename T>
+inline constexpr bool always_false = false;
+
+/**
+ * @brief Representation type that does not compile when its scaling is instantiated
+ *
+ * Checking if the quantities of this type are convertible must not instantiate the conversion itself.
+ *
+ * @tparam T element type
+ */
+template<typename T>
+class poisoned {
+  T value_;
+public:
+  using value_type = T;
+
+  poisoned() = default;
+  constexpr explicit(false) poisoned(T v) noexcept : value_(v) {}
+  template<typename U>
+  constexpr explicit(false) poisoned(poisoned<U> v) noexcept : value_(static_cast<T>(v.value()))
+  {
+  }
+  [[nodiscard]] constexpr T value() const noexcept { return value_; }
+
+  [[nodiscard]] friend constexpr bool operator==(poisoned, poisoned) = default;
+
+  template<typename U>
+  [[nodiscard]] friend constexpr poisoned operator*(const poisoned&, const U&)
+  {
+    static_assert(always_false<U>, "the scaling of the value was instantiated");
+    return {};
+  }
+
+  template<typename U>
+  [[nodiscard]] friend constexpr poisoned operator/(const poisoned&, const U&)
+  {
+    static_assert(always_false<U>, "the scaling of the value was instantiated");
+    return {};
+  }
+};
+
+}  // namespace
+
+template<typename T>
+inline constexpr bool mp_units::is_scalar<poisoned<T>> = true;
+
+template<typename T, typename U>
+struct std::common_type<poisoned<T>, poisoned<U>> : std::type_identity<poisoned<std::common_type_t<T, U>>> {};
+template<typename T, typename U>
+struct std::common_type<poisoned<T>, U> : std::type_identity<poisoned<std::common_type_t<T, U>>> {};
+template<typename U, typename T>
+struct std::common_type<U, poisoned<T>> : std::type_identity<poisoned<std::common_type_t<T, U>>> {};
+
+namespace {
+
+using namespace mp_units;
+using namespace mp_units::si::unit_symbols;
+
+static_assert(Representation<poisoned<int>>);
+static_assert(Representation<poisoned<double>>);
+
+// the constructors are selected without instantiating the scaling of the values
+static_assert(std::constructible_from<quantity<m, poisoned<int>>, quantity<km, poisoned<int>>>);
+static_assert(std::convertible_to<quantity<km, poisoned<int>>, quantity<m, poisoned<int>>>);
+static_assert(!std::constructible_from<quantity<km, poisoned<int>>, quantity<m, poisoned<int>>>);  // truncating
+static_assert(!std::convertible_to<quantity<m, poisoned<int>>, quantity<km, poisoned<int>>>);
+
+static_assert(std::constructible_from<quantity<km, poisoned<double>>, quantity<m, poisoned<double>>>);
+static_assert(std::convertible_to<quantity<m, poisoned<double>>, quantity<km, poisoned<double>>>);
+static_assert(std::constructible_from<quantity<km, poisoned<double>>, quantity<m, poisoned<int>>>);
+static_assert(std::convertible_to<quantity<m, poisoned<int>>, quantity<km, poisoned<double>>>);
+
+static_assert(detail::SudoCastable<quantity<m, poisoned<int>>, quantity<km, poisoned<int>>>);
+static_assert(detail::SudoCastable<quantity<km, poisoned<double>>, quantity<m, poisoned<int>>>);
+static_assert(detail::SudoCastable<quantity<mag<2> * m, poisoned<int>>, quantity<m, poisoned<int>>>);
+
+// the representation types have to be convertible
+static_assert(detail::SudoCastable<quantity<m, int>, quantity<m, std::int8_t>>);
+static_assert(detail::SudoCastable<quantity<km, double>, quantity<m, std::int8_t>>);
+static_assert(!detail::SudoCastable<quantity<m, poisoned<int>>, quantity<m, int>>);
+static_assert(!detail::SudoCastable<quantity<m, int>, quantity<s, int>>);
+
+}  // namespace
@@ -25,7 +25,9 @@
 #include <mp-units/systems/isq/mechanics.h>
 #include <mp-units/systems/isq/space_and_time.h>
 #include <mp-units/systems/si/si.h>
+#include <cstdint>
 #include <limits>
+#include <numbers>
 #include <utility>
 
 template<>
@@ -217,6 +219,40 @@ static_assert(quantity<isq::length[km], int>(2 * km).force_in(km).numerical_valu
 static_assert(quantity<isq::length[km], int>(2 * km).force_in(m).numerical_value_ == 2000);
 static_assert(quantity<isq::length[m], int>(2000 * m).force_in(km).numerical_value_ == 2);
 
+// the factors which numerator or denominator do not fit in `std::intmax_t` are applied with 128-bit integers
+inline constexpr struct wide_unit : named_unit<"wu", mag_power<10, 20> / mag_power<3, 30> * si::metre> {
+} wide_unit;
+static_assert((std::int64_t{1000} * wide_unit).force_in(m).numerical_value_in(m) == 485'693'574);
+// the Avogadro constant with the smallest prefixes leaves a denominator of 2.5e20
+static_assert((std::int64_t{1'000'000'000'000'000'000} * si::si2019::avogadro_constant * si::quecto<si::mole> / s)
+                .force_in(one / us)
+                .numerical_value_in(one / us) == 602'214);
+static_assert((std::int64_t{1'000'000'000'000'000'000} * si::si2019::avogadro_constant * si::ronto<si::mole> / s)
+                .force_in(one / ns)
+                .numerical_value_in(one / ns) == 602'214);
+
+// irrational factors are evaluated with extended precision and rounded only once to the representation type
+static_assert((180. * si::degree).numerical_value_in(si::radian) == std::numbers::pi);
+static_assert((2.f * (mag_pi / mag<2> * m)).numerical_value_in(m) == std::numbers::pi_v<float>);
+static_assert((1. * (pow<1, 2>(mag<2>) * m)).numerical_value_in(m) == std::numbers::sqrt2);
+static_assert(detail::double_double{1. + 0x1p-24, 0x1p-60}.to<float>() == 1.f + 0x1p-23f);
+static_assert(detail::double_double{1. + 0x1p-24, -0x1p-60}.to<float>() == 1.f);
+static_assert(detail::double_double{1. + 0x1p-24}.to<float>() == 1.f);
+
+// the magnitudes out of the exponent range of `double` are evaluated in `long double`
+template<typename T>
+consteval bool out_of_double_range_magnitudes()
+{
+  if constexpr (std::numeric_limits<T>::max_exponent10 > 400) {
+    constexpr auto huge = get_value<T>(mag_power<10, 400>);
+    constexpr auto tiny = get_value<T>(mag_power<10, -320>);
+    return huge > std::numeric_limits<double>::max() && tiny > 0 && tiny < std::numeric_limits<double>::min() &&
+           (T{2} * (mag_power<10, 400> * m)).numerical_value_in(m) == 2 * huge;
+  } else
+    return true;
+}
+static_assert(out_of_double_range_magnitudes<long double>());
+
 template<template<auto, typename> typename Q>
 concept invalid_unit_conversion = requires {
   requires !requires { Q<isq::length[m], int>(2000 * m).in(km); };     // truncating conversion
@@ -384,6 +420,12 @@ static_assert((2.5 * m *= 3 * one).numerical_value_ == 7.5);
 static_assert((7.5 * m /= 3 * one).numerical_value_ == 2.5);
 static_assert((3500 * m %= 1 * km).numerical_value_ == 500);
 
+// different units and convertible quantity specifications
+static_assert((1. * m += 1 * mm).numerical_value_ == 1.001);
+static_assert((1. * m -= 1 * mm).numerical_value_ == 0.999);
+static_assert((1 * isq::length[m] += 1 * isq::height[km]).numerical_value_ == 1001);
+static_assert((1001 * isq::length[m] -= 1 * isq::height[km]).numerical_value_ == 1);
+
 // static_assert((std::uint8_t(255) * m %= 256 * m).numerical_value_ == [] {
 //   std::uint8_t ui(255);
 //   return ui %= 256;
@@ -416,6 +458,12 @@ concept invalid_compound_assignments = requires() {
   requires !requires(Q<isq::length[km], int> l) { l %= 2 * percent; };
   requires !requires(Q<isq::length[km], int> l) { l %= 2. * percent; };
 
+  // only implicitly convertible quantities can be added or subtracted
+  requires !requires(Q<isq::height[m], int> l) { l += 2 * isq::length[m]; };
+  requires !requires(Q<isq::height[m], int> l) { l -= 2 * isq::length[m]; };
+  requires !requires(Q<isq::length[m], int> l) { l += 2 * isq::time[s]; };
+  requires !requires(Q<isq::length[m], int> l) { l -= 2 * isq::time[s]; };
+
   // TODO: accept non-truncating argument
   requires !requires(Q<isq::length[km], int> l) { l *= 1 * (km / m); };
   requires !requires(Q<isq::length[km], int> l) { l /= 1 * (km / m); };
@@ -811,6 +859,21 @@ static_assert(321 * km != 123'000 * m);
 static_assert(!(123 * km == 321'000 * m));
 static_assert(!(123 * km != 123'000 * m));
 
+// integral values in units which are not multiples of each other are cross-multiplied
+static_assert(2 * (mag<3> * m) == 3 * (mag<2> * m));
+static_assert(2 * (mag<3> * m) != 4 * (mag<2> * m));
+
+// the cross-products of 64-bit values do not overflow
+inline constexpr std::int64_t int64_max = std::numeric_limits<std::int64_t>::max();
+inline constexpr std::int64_t int64_min = std::numeric_limits<std::int64_t>::min();
+inline constexpr std::uint64_t uint64_max = std::numeric_limits<std::uint64_t>::max();
+static_assert((int64_max / 1000 + 1) * km > int64_max * m);
+static_assert((int64_max / 1000) * km < int64_max * m);
+static_assert((int64_max / 1000) * km == (int64_max / 1000 * 1000) * m);
+static_assert((int64_min / 1000 - 1) * km < int64_min * m);
+static_assert((uint64_max / 1000 + 1) * km > uint64_max * m);
+static_assert(int64_max * (mag<3> * m) > (int64_max - 1) * (mag<2> * m));
+
 // Named and derived dimensions (same units)
 static_assert(10 * isq::length[m] / (2 * isq::time[s]) == 5 * isq::speed[m / s]);
 static_assert(5 * isq::speed[m / s] == 10 * isq::length[m] / (2 * isq::time[s]));
@@ -888,6 +951,11 @@ static_assert(!(123 * km > 321'000 * m));
 static_assert(!(123 * km > 123'000 * m));
 static_assert(!(123 * km >= 321'000 * m));
 
+static_assert(-2 * km < -1'999 * m);
+static_assert(2 * (mag<3> * m) < 4 * (mag<2> * m));
+static_assert(4 * (mag<2> * m) > 2 * (mag<3> * m));
+static_assert(std::is_eq(2 * (mag<3> * m) <=> 3 * (mag<2> * m)));
+
 
 //////////////////
 // dimensionless
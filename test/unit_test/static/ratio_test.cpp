@@ -40,6 +40,7 @@ static_assert(-ratio(3, 8) == ratio(-3, 8));
 
 // ratio addition
 static_assert(ratio(1, 2) + ratio(1, 3) == ratio(5, 6));
+static_assert(ratio(1, 3'000'000'000'000) + ratio(1, 7'000'000'000'000) == ratio(10, 21'000'000'000'000));
 
 static_assert(ratio(4) / ratio(2) == ratio(2));
 static_assert(ratio(2) / ratio(8) == ratio(1, 4));
@@ -54,10 +55,12 @@ static_assert(common_ratio(ratio(1, 1000), ratio(1)) == ratio(1, 1000));
 static_assert(common_ratio(ratio(100, 1), ratio(10, 1)) == ratio(10, 1));
 static_assert(common_ratio(ratio(100, 1), ratio(1, 10)) == ratio(1, 10));
 static_assert(common_ratio(ratio(2), ratio(4)) == ratio(2));
+static_assert(common_ratio(ratio(1, 3'000'000'000'000), ratio(1, 7'000'000'000'000)) == ratio(1, 21'000'000'000'000));
 
 // comparison
 static_assert((ratio(3, 4) <=> ratio(6, 8)) == (0 <=> 0));
 static_assert((ratio(3, 4) <=> ratio(-3, 4)) == (0 <=> -1));
 static_assert((ratio(-3, 4) <=> ratio(3, -4)) == (0 <=> 0));
+static_assert(ratio(1, 3'000'000'000'000) < ratio(1, 2'999'999'999'999));
 
 }  // namespace
@@ -21,6 +21,7 @@
 // SOFTWARE.
 
 #include <mp-units/bits/external/type_list.h>
+#include <mp-units/bits/external/type_name.h>
 #include <mp-units/bits/external/type_traits.h>
 
 namespace {
@@ -183,4 +184,22 @@ static_assert(is_same_v<type_list_sort<type_list<v2, v1>, constant_less>, type_l
 static_assert(is_same_v<type_list_sort<type_list<v2, v1, v3>, constant_less>, type_list<v1, v2, v3>>);
 static_assert(is_same_v<type_list_sort<type_list<v4, v3, v2, v1>, constant_less>, type_list<v1, v2, v3, v4>>);
 
+// type_name_less
+
+namespace ns1 {
+struct same_name {};
+}  // namespace ns1
+
+namespace ns2 {
+struct same_name {};
+}  // namespace ns2
+
+static_assert(class_key_length("wrapper<struct a>", 8) == 7);
+static_assert(class_key_length("my_struct a", 3) == 0);
+static_assert(unqualified_type_name<ns1::same_name>() == "same_name");
+static_assert(type_name_hash<ns1::same_name> == type_name_hash<ns2::same_name>);
+static_assert(type_name_less<ns1::same_name, ns2::same_name> != type_name_less<ns2::same_name, ns1::same_name>);
+static_assert(!type_name_less<ns1::same_name, ns1::same_name>);
+static_assert(type_name_less<v1, v2> != type_name_less<v2, v1>);
+
 }  // namespace
@@ -26,6 +26,7 @@
 #include <mp-units/reference.h>
 #include <mp-units/systems/si/prefixes.h>
 #include <mp-units/unit.h>
+#include <numbers>
 
 namespace {
 
@@ -540,4 +541,20 @@ static_assert(is_of_type<common_unit(kilometre, mile), scaled_unit<mag<ratio{8,
 static_assert(is_of_type<common_unit(mile, kilometre), scaled_unit<mag<ratio{8, 125}>, metre_>>);
 static_assert(is_of_type<common_unit(speed_of_light_in_vacuum, metre / second), derived_unit<metre_, per<second_>>>);
 
+// conversion_factor_v
+template<auto From, auto To, typename Rep = double>
+concept has_conversion_factor = requires { conversion_factor_v<From, To, Rep>; };
+
+static_assert(std::is_same_v<decltype(conversion_factor_v<kilometre, metre>), const double>);
+static_assert(conversion_factor_v<kilometre, metre> == 1000.);
+static_assert(conversion_factor_v<metre, kilometre> == 0.001);
+static_assert(conversion_factor_v<hour, second, int> == 3600);
+static_assert(conversion_factor_v<mile, yard, long> == 1760);
+static_assert(conversion_factor_v<kilometre / hour, metre / second> == 5. / 18.);
+static_assert(conversion_factor_v<degree, radian, float> == std::numbers::pi_v<float> / 180);
+static_assert(conversion_factor_v<hertz, becquerel> == 1.);
+static_assert(has_conversion_factor<metre, kilometre>);
+static_assert(!has_conversion_factor<metre, second>);
+static_assert(!has_conversion_factor<metre, kilometre, int>);
+
 }  // namespace